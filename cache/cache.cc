@@ -64,6 +64,11 @@ static std::unordered_map<std::string, OptionTypeInfo>
                    enable_custom_split_merge),
           OptionType::kBoolean, OptionVerificationType::kNormal,
           OptionTypeFlags::kMutable}},
+        {"use_hyper_clock_cache",
+         {offsetof(struct CompressedSecondaryCacheOptions,
+                   use_hyper_clock_cache),
+          OptionType::kBoolean, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
 };
 
 namespace {
@@ -4,6 +4,8 @@
 //  (found in the LICENSE.Apache file in the root directory).
 
 #ifdef GFLAGS
+#include <array>
+#include <atomic>
 #include <cinttypes>
 #include <cstddef>
 #include <cstdio>
@@ -11,10 +13,12 @@
 #include <memory>
 #include <set>
 #include <sstream>
+#include <thread>
 
 #include "cache/cache_key.h"
 #include "cache/sharded_cache.h"
 #include "db/db_impl/db_impl.h"
+#include "memory/memory_allocator_impl.h"
 #include "monitoring/histogram.h"
 #include "port/port.h"
 #include "port/stack_trace.h"
@@ -25,8 +29,10 @@
 #include "rocksdb/secondary_cache.h"
 #include "rocksdb/system_clock.h"
 #include "rocksdb/table_properties.h"
+#include "rocksdb/trace_reader_writer.h"
 #include "table/block_based/block_based_table_reader.h"
 #include "table/block_based/cachable_entry.h"
+#include "trace_replay/block_cache_tracer.h"
 #include "util/coding.h"
 #include "util/distributed_mutex.h"
 #include "util/gflags_compat.h"
@@ -119,6 +125,22 @@ DEFINE_string(secondary_cache_uri, "",
 
 DEFINE_string(cache_type, "lru_cache", "Type of block cache.");
 
+DEFINE_uint64(frequency_admission_entries, 0,
+              "If > 0, ShardedCacheOptions::frequency_admission_entries");
+
+DEFINE_bool(adaptive_pool_ratios, false,
+            "For lru_cache, LRUCacheOptions::adaptive_pool_ratios");
+
+DEFINE_string(trace_file, "",
+              "If non-empty, replay the block cache accesses of this trace, "
+              "as written by DB::StartBlockCacheTrace(), on --threads "
+              "threads instead of running the synthetic workload. Reports "
+              "hit ratio, throughput and latency per CacheEntryRole.");
+
+DEFINE_uint32(trace_replay_passes, 1,
+              "Number of times to replay --trace_file. Later passes replay "
+              "the trace against the cache state left by earlier ones.");
+
 DEFINE_bool(use_jemalloc_no_dump_allocator, false,
             "Whether to use JemallocNoDumpAllocator");
 
@@ -331,6 +353,49 @@ Cache::CacheItemHelper helper3_wos(CacheEntryRole::kFilterBlock, DeleteFn);
 Cache::CacheItemHelper helper3(CacheEntryRole::kFilterBlock, DeleteFn, SizeFn,
                                SaveToFn, CreateFn, &helper3_wos);
 
+// For trace replay, values have the sizes of the traced blocks, so the
+// allocated size is stored in the first 8 bytes of each value
+constexpr size_t kTraceValueHeaderSize = 8;
+
+size_t TraceSizeFn(Cache::ObjectPtr obj) {
+  return static_cast<size_t>(DecodeFixed64(static_cast<char*>(obj)));
+}
+
+Cache::ObjectPtr CreateTraceValue(size_t block_size, MemoryAllocator* alloc) {
+  size_t size = std::max(block_size, kTraceValueHeaderSize);
+  char* rv = AllocateBlock(size, alloc).release();
+  EncodeFixed64(rv, size);
+  return rv;
+}
+
+#define TRACE_HELPERS(name, role)                                        \
+  Cache::CacheItemHelper name##_wos(role, DeleteFn);                     \
+  Cache::CacheItemHelper name(role, DeleteFn, TraceSizeFn, SaveToFn,     \
+                              CreateFn, &name##_wos)
+TRACE_HELPERS(trace_data_helper, CacheEntryRole::kDataBlock);
+TRACE_HELPERS(trace_index_helper, CacheEntryRole::kIndexBlock);
+TRACE_HELPERS(trace_filter_helper, CacheEntryRole::kFilterBlock);
+TRACE_HELPERS(trace_other_helper, CacheEntryRole::kOtherBlock);
+#undef TRACE_HELPERS
+
+// A block cache access read from --trace_file
+struct TraceAccess {
+  std::string key;
+  uint64_t block_size;
+  const Cache::CacheItemHelper* helper;
+  Cache::Priority priority;
+  // Lookup only, e.g. for a read with fill_cache=false
+  bool no_insert;
+};
+
+// Per-thread results of a trace replay, indexed by CacheEntryRole
+struct TraceReplayStats {
+  std::array<uint64_t, kNumCacheEntryRoles> hits{};
+  std::array<uint64_t, kNumCacheEntryRoles> misses{};
+  std::array<HistogramImpl, kNumCacheEntryRoles> latency_ns;
+  uint64_t duration_us = 0;
+};
+
 void ConfigureSecondaryCache(ShardedCacheOptions& opts) {
   if (!FLAGS_secondary_cache_uri.empty()) {
     std::shared_ptr<SecondaryCache> secondary_cache;
@@ -395,6 +460,8 @@ class CacheBench {
       opts.hash_seed = BitwiseAnd(FLAGS_seed, INT32_MAX);
       opts.memory_allocator = allocator;
       opts.eviction_effort_cap = FLAGS_eviction_effort_cap;
+      opts.frequency_admission_entries =
+          static_cast<size_t>(FLAGS_frequency_admission_entries);
       if (FLAGS_cache_type == "fixed_hyper_clock_cache" ||
           FLAGS_cache_type == "hyper_clock_cache") {
         opts.estimated_entry_charge = FLAGS_value_bytes_estimate > 0
@@ -416,6 +483,9 @@ class CacheBench {
                            0.5 /* high_pri_pool_ratio */);
       opts.hash_seed = BitwiseAnd(FLAGS_seed, INT32_MAX);
       opts.memory_allocator = allocator;
+      opts.frequency_admission_entries =
+          static_cast<size_t>(FLAGS_frequency_admission_entries);
+      opts.adaptive_pool_ratios = FLAGS_adaptive_pool_ratios;
       ConfigureSecondaryCache(opts);
       cache_ = NewLRUCache(opts);
     } else {
@@ -426,6 +496,141 @@ class CacheBench {
 
   ~CacheBench() = default;
 
+  // Reads all of --trace_file into memory, so that replay throughput is not
+  // limited by trace decoding
+  bool LoadTrace() {
+    std::unique_ptr<TraceReader> trace_reader;
+    Status s = NewFileTraceReader(Env::Default(), EnvOptions(),
+                                  FLAGS_trace_file, &trace_reader);
+    BlockCacheTraceHeader header;
+    std::unique_ptr<BlockCacheTraceReader> reader;
+    if (s.ok()) {
+      reader.reset(new BlockCacheTraceReader(std::move(trace_reader)));
+      s = reader->ReadHeader(&header);
+    }
+    if (!s.ok()) {
+      fprintf(stderr, "Cannot read trace %s: %s\n", FLAGS_trace_file.c_str(),
+              s.ToString().c_str());
+      return false;
+    }
+    for (;;) {
+      BlockCacheTraceRecord record;
+      // Stops at the end of the trace, or at a truncated last record
+      if (!reader->ReadAccess(&record).ok()) {
+        break;
+      }
+      TraceAccess access;
+      access.key = std::move(record.block_key);
+      access.block_size = record.block_size;
+      access.no_insert = record.no_insert;
+      // Like BlockBasedTable with the default
+      // cache_index_and_filter_blocks_with_high_priority
+      access.priority = Cache::Priority::HIGH;
+      switch (record.block_type) {
+        case TraceType::kBlockTraceDataBlock:
+          access.helper = &trace_data_helper;
+          access.priority = Cache::Priority::LOW;
+          break;
+        case TraceType::kBlockTraceIndexBlock:
+          access.helper = &trace_index_helper;
+          break;
+        case TraceType::kBlockTraceFilterBlock:
+          access.helper = &trace_filter_helper;
+          break;
+        default:
+          access.helper = &trace_other_helper;
+          access.priority = Cache::Priority::LOW;
+          break;
+      }
+      trace_.push_back(std::move(access));
+    }
+    if (trace_.empty()) {
+      fprintf(stderr, "No block cache accesses in trace %s\n",
+              FLAGS_trace_file.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  // Replays the loaded trace against the cache. Threads claim the accesses
+  // in trace order in small batches, so that concurrent accesses are close
+  // in trace time as they were originally.
+  bool ReplayTrace() {
+    const auto clock = SystemClock::Default().get();
+    printf("----------------------------\n");
+    printf("Cache impl name     : %s\n", cache_->Name());
+    printf("Number of threads   : %u\n", FLAGS_threads);
+    printf("Cache size          : %s\n",
+           BytesToHumanString(FLAGS_cache_size).c_str());
+    printf("Trace file          : %s\n", FLAGS_trace_file.c_str());
+    printf("Trace accesses      : %zu\n", trace_.size());
+    printf("Replay passes       : %u\n", FLAGS_trace_replay_passes);
+    printf("----------------------------\n");
+
+    const uint64_t total_ops =
+        uint64_t{trace_.size()} * FLAGS_trace_replay_passes;
+    std::atomic<uint64_t> next_op{0};
+    std::vector<std::unique_ptr<TraceReplayStats>> stats(FLAGS_threads);
+    std::vector<std::thread> threads;
+    const uint64_t start_time = clock->NowMicros();
+    for (uint32_t i = 0; i < FLAGS_threads; i++) {
+      stats[i].reset(new TraceReplayStats());
+      threads.emplace_back([this, &next_op, total_ops, s = stats[i].get()]() {
+        ReplayTraceThread(&next_op, total_ops, s);
+      });
+    }
+    for (auto& t : threads) {
+      t.join();
+    }
+    const uint64_t end_time = clock->NowMicros();
+
+    double elapsed_secs = static_cast<double>(end_time - start_time) * 1e-6;
+    printf("Complete in %.3f s; Rough parallel ops/sec = %u\n", elapsed_secs,
+           static_cast<uint32_t>(total_ops / elapsed_secs));
+    elapsed_secs = 0;
+    for (auto& s : stats) {
+      elapsed_secs += s->duration_us * 1e-6;
+    }
+    printf("Thread ops/sec = %u\n",
+           static_cast<uint32_t>(FLAGS_threads * total_ops / elapsed_secs));
+
+    TraceReplayStats combined;
+    for (auto& s : stats) {
+      for (uint32_t r = 0; r < kNumCacheEntryRoles; r++) {
+        combined.hits[r] += s->hits[r];
+        combined.misses[r] += s->misses[r];
+        combined.latency_ns[r].Merge(s->latency_ns[r]);
+      }
+    }
+    uint64_t hits = 0;
+    for (uint32_t r = 0; r < kNumCacheEntryRoles; r++) {
+      hits += combined.hits[r];
+    }
+    printf("Lookup hit ratio: %g\n", 1.0 * hits / total_ops);
+
+    printf("\n%-16s %12s %10s %10s %10s %10s\n", "Role", "Accesses",
+           "Hit ratio", "p50 ns", "p99 ns", "p99.9 ns");
+    for (uint32_t r = 0; r < kNumCacheEntryRoles; r++) {
+      uint64_t accesses = combined.hits[r] + combined.misses[r];
+      if (accesses == 0) {
+        continue;
+      }
+      const HistogramImpl& hist = combined.latency_ns[r];
+      printf("%-16s %12" PRIu64 " %10.4f %10.0f %10.0f %10.0f\n",
+             GetCacheEntryRoleName(static_cast<CacheEntryRole>(r)).c_str(),
+             accesses, 1.0 * combined.hits[r] / accesses, hist.Percentile(50),
+             hist.Percentile(99), hist.Percentile(99.9));
+    }
+
+    if (FLAGS_report_problems) {
+      printf("\n");
+      std::shared_ptr<Logger> logger =
+          std::make_shared<StderrLogger>(InfoLogLevel::DEBUG_LEVEL);
+      cache_->ReportProblems(logger);
+    }
+    return true;
+  }
+
   void PopulateCache() {
     Random64 rnd(FLAGS_seed);
     KeyGen keygen;
@@ -572,6 +777,8 @@ class CacheBench {
   const uint64_t blind_insert_threshold_;
   const uint64_t lookup_threshold_;
   const uint64_t erase_threshold_;
+  // Accesses of --trace_file, see LoadTrace()
+  std::vector<TraceAccess> trace_;
 
   // A benchmark version of gathering stats on an active block cache by
   // iterating over it. The primary purpose is to measure the impact of
@@ -805,6 +1012,56 @@ class CacheBench {
     thread->duration_us = clock->NowMicros() - start_time;
   }
 
+  void ReplayTraceThread(std::atomic<uint64_t>* next_op, uint64_t total_ops,
+                         TraceReplayStats* stats) {
+    constexpr uint64_t kBatchSize = 16;
+    const auto clock = SystemClock::Default().get();
+    const uint64_t start_time = clock->NowMicros();
+    StopWatchNano timer(clock);
+    uint64_t result = 0;
+    for (;;) {
+      uint64_t begin =
+          next_op->fetch_add(kBatchSize, std::memory_order_relaxed);
+      if (begin >= total_ops) {
+        break;
+      }
+      uint64_t end = std::min(begin + kBatchSize, total_ops);
+      for (uint64_t op = begin; op < end; op++) {
+        const TraceAccess& access = trace_[op % trace_.size()];
+        const size_t role = static_cast<size_t>(access.helper->role);
+        timer.Start();
+        Cache::Handle* handle =
+            cache_->Lookup(access.key, access.helper, /*context*/ nullptr,
+                           access.priority);
+        if (handle != nullptr) {
+          if (!FLAGS_lean) {
+            // Touch the value like a reader of the block would
+            result += *static_cast<char*>(cache_->Value(handle));
+          }
+          cache_->Release(handle);
+          stats->hits[role]++;
+        } else {
+          stats->misses[role]++;
+          if (!access.no_insert) {
+            Status s = cache_->Insert(
+                access.key,
+                CreateTraceValue(static_cast<size_t>(access.block_size),
+                                 cache_->memory_allocator()),
+                access.helper, access.block_size, /*handle=*/nullptr,
+                access.priority);
+            s.PermitUncheckedError();
+          }
+        }
+        stats->latency_ns[role].Add(timer.ElapsedNanos());
+      }
+    }
+    // Ensure computations on `result` are not optimized away.
+    if (result == 1) {
+      printf("%s", "");
+    }
+    stats->duration_us = clock->NowMicros() - start_time;
+  }
+
   void PrintEnv() const {
 #if defined(__GNUC__) && !defined(__OPTIMIZE__)
     printf(
@@ -1162,6 +1419,13 @@ int cache_bench_tool(int argc, char** argv) {
   }
 
   ROCKSDB_NAMESPACE::CacheBench bench;
+  if (!FLAGS_trace_file.empty()) {
+    if (FLAGS_trace_replay_passes == 0) {
+      fprintf(stderr, "trace_replay_passes must be > 0\n");
+      exit(1);
+    }
+    return bench.LoadTrace() && bench.ReplayTrace() ? 0 : 1;
+  }
   if (FLAGS_populate_cache) {
     bench.PopulateCache();
   }
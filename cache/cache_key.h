@@ -6,6 +6,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
 
 #include "rocksdb/rocksdb_namespace.h"
 #include "rocksdb/slice.h"
@@ -127,6 +128,17 @@ class OffsetableCacheKey : private CacheKey {
     return CacheKey(file_num_etc64_, offset_etc64_ ^ offset);
   }
 
+  // The inverse of WithOffset(), for a cache key (as from AsSlice()) known
+  // to have this common prefix.
+  inline uint64_t OffsetOfKey(const Slice &key) const {
+    assert(key.size() == kCacheKeySize);
+    assert(key.starts_with(CommonPrefixSlice()));
+    uint64_t offset_etc64;
+    memcpy(&offset_etc64, key.data() + kCommonPrefixSize,
+           sizeof(offset_etc64));
+    return offset_etc64 ^ offset_etc64_;
+  }
+
   // The "common prefix" is a shared prefix for all the returned CacheKeys.
   // It is specific to the file but the same for all offsets within the file.
   static constexpr size_t kCommonPrefixSize = 8;
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "cache/lru_cache.h"
+#include "cache/partitioned_cache.h"
 #include "cache/typed_cache.h"
 #include "port/stack_trace.h"
 #include "table/block_based/block_cache.h"
@@ -809,6 +810,54 @@ TEST_P(CacheTest, OverCapacity) {
   }
 }
 
+TEST_P(CacheTest, FrequencyAdmission) {
+  const int kEntries = 10;
+  std::shared_ptr<Cache> cache =
+      NewCache(kEntries, [](ShardedCacheOptions& opts) {
+        opts.num_shard_bits = 0;
+        opts.metadata_charge_policy = kDontChargeCacheMetadata;
+        opts.frequency_admission_entries = 1000;
+      });
+
+  // Fill the cache with a hot working set, each accessed several times
+  for (int i = 0; i < kEntries; i++) {
+    ASSERT_EQ(-1, Lookup(cache, i));
+    Insert(cache, i, i + 1000);
+    for (int j = 0; j < 3; j++) {
+      ASSERT_EQ(i + 1000, Lookup(cache, i));
+    }
+  }
+
+  // A scan of one-time accesses is not admitted
+  for (int i = 100; i < 200; i++) {
+    ASSERT_EQ(-1, Lookup(cache, i));
+    Insert(cache, i, i + 1000);
+    ASSERT_EQ(i + 1000, deleted_values_.back());
+  }
+  for (int i = 0; i < kEntries; i++) {
+    ASSERT_EQ(i + 1000, Lookup(cache, i));
+  }
+
+  // A rejected entry is still available through the requested handle
+  deleted_values_.clear();
+  Cache::Handle* h = nullptr;
+  ASSERT_EQ(-1, Lookup(cache, 200));
+  ASSERT_OK(cache->Insert(EncodeKey(200), EncodeValue(1200), &kHelper, 1, &h));
+  ASSERT_NE(h, nullptr);
+  ASSERT_EQ(1200, DecodeValue(cache->Value(h)));
+  ASSERT_TRUE(deleted_values_.empty());
+  cache->Release(h);
+  ASSERT_EQ(1, deleted_values_.size());
+  ASSERT_EQ(-1, Lookup(cache, 200));
+
+  // A frequently accessed new entry is admitted
+  for (int j = 0; j < 10; j++) {
+    ASSERT_EQ(-1, Lookup(cache, 300));
+  }
+  Insert(cache, 300, 1300);
+  ASSERT_EQ(1300, Lookup(cache, 300));
+}
+
 TEST_P(CacheTest, ApplyToAllEntriesTest) {
   std::vector<std::string> callback_state;
   const auto callback = [&](const Slice& key, Cache::ObjectPtr value,
@@ -1101,6 +1150,87 @@ TEST(MiscBlockCacheTest, UncacheAggressivenessAdvisor) {
   }
 }
 
+TEST(PartitionedCacheTest, MinAndMaxShares) {
+  LRUCacheOptions lru_opts;
+  lru_opts.num_shard_bits = 0;
+  lru_opts.high_pri_pool_ratio = 0.0;
+  lru_opts.metadata_charge_policy = kDontChargeCacheMetadata;
+  PartitionedCacheOptions opts;
+  opts.cache_opts = &lru_opts;
+  opts.total_capacity = 1000;
+  std::shared_ptr<PartitionedCache> cache;
+  ASSERT_TRUE(NewPartitionedCache(opts, &cache).IsInvalidArgument());
+  opts.partitions = {{0.6, 1.0}, {0.5, 1.0}};
+  ASSERT_TRUE(NewPartitionedCache(opts, &cache).IsInvalidArgument());
+  opts.partitions = {{0.6, 0.5}};
+  ASSERT_TRUE(NewPartitionedCache(opts, &cache).IsInvalidArgument());
+
+  opts.partitions = {{0.5, 1.0}, {0.2, 0.5}, {0.0, 1.0}};
+  ASSERT_OK(NewPartitionedCache(opts, &cache));
+  ASSERT_EQ(cache->NumPartitions(), 3U);
+  ASSERT_EQ(cache->GetPartitionCapacity(0), 500U);
+  ASSERT_EQ(cache->GetPartitionCapacity(1), 200U);
+  ASSERT_EQ(cache->GetPartitionCapacity(2), 0U);
+  std::shared_ptr<Cache> p0 = cache->GetPartition(0);
+  std::shared_ptr<Cache> p1 = cache->GetPartition(1);
+  std::shared_ptr<Cache> p2 = cache->GetPartition(2);
+  // Managed by the PartitionedCache
+  p0->SetCapacity(0);
+  ASSERT_EQ(p0->GetCapacity(), 500U);
+
+  auto insert = [](const std::shared_ptr<Cache>& c, int begin, int end) {
+    for (int i = begin; i < end; i++) {
+      ASSERT_OK(c->Insert(EncodeKey16Bytes(i), nullptr, &kDumbHelper, 10));
+    }
+  };
+  auto count = [](const std::shared_ptr<Cache>& c, int begin, int end) {
+    int found = 0;
+    for (int i = begin; i < end; i++) {
+      Cache::Handle* h = c->Lookup(EncodeKey16Bytes(i));
+      if (h != nullptr) {
+        found++;
+        c->Release(h);
+      }
+    }
+    return found;
+  };
+
+  // A partition can borrow the whole cache while the others are idle
+  insert(p2, 0, 100);
+  ASSERT_EQ(cache->GetPartitionCapacity(2), 1000U);
+  ASSERT_EQ(cache->GetPartitionCapacity(0), 0U);
+  ASSERT_EQ(count(p2, 0, 100), 100);
+
+  // Borrowed capacity is reclaimed up to the minimum share
+  insert(p0, 0, 100);
+  ASSERT_EQ(cache->GetPartitionCapacity(0), 500U);
+  ASSERT_EQ(cache->GetPartitionCapacity(2), 500U);
+  ASSERT_EQ(count(p0, 50, 100), 50);
+  ASSERT_EQ(count(p2, 50, 100), 50);
+  insert(p1, 0, 50);
+  ASSERT_EQ(cache->GetPartitionCapacity(1), 200U);
+  ASSERT_EQ(cache->GetPartitionCapacity(2), 300U);
+
+  // A noisy partition evicts only its own entries
+  insert(p2, 100, 1000);
+  ASSERT_EQ(count(p0, 50, 100), 50);
+  ASSERT_EQ(count(p1, 30, 50), 20);
+  ASSERT_EQ(cache->GetPartitionCapacity(2), 300U);
+
+  // Idle capacity can be borrowed up to the maximum share
+  for (int i = 0; i < 1000; i++) {
+    p2->Erase(EncodeKey16Bytes(i));
+  }
+  insert(p1, 50, 100);
+  ASSERT_EQ(cache->GetPartitionCapacity(1), 500U);
+  ASSERT_EQ(cache->GetPartitionCapacity(2), 0U);
+  ASSERT_EQ(count(p1, 50, 100), 50);
+
+  // Partitions remain usable without the PartitionedCache
+  cache.reset();
+  ASSERT_EQ(count(p0, 50, 100), 50);
+}
+
 }  // namespace ROCKSDB_NAMESPACE
 
 int main(int argc, char** argv) {
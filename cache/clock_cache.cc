@@ -1357,6 +1357,14 @@ size_t ClockCacheShard<Table>::GetStandaloneUsage() const {
   return table_.GetStandaloneUsage();
 }
 
+template <class Table>
+bool ClockCacheShard<Table>::NeedsEvictionFor(size_t charge,
+                                              HashVal* /*victim*/,
+                                              bool* have_victim) {
+  *have_victim = false;
+  return table_.GetUsage() + charge > capacity_.LoadRelaxed();
+}
+
 template <class Table>
 size_t ClockCacheShard<Table>::GetCapacity() const {
   return capacity_.LoadRelaxed();
@@ -1020,6 +1020,10 @@ class ALIGN_AS(CACHE_LINE_SIZE) ClockCacheShard final : public CacheShardBase {
     BijectiveHash2x64(in[1], in[0] ^ seed, &out[1], &out[0]);
     return out;
   }
+  static inline uint64_t HashForAdmission(HashCref hash) { return hash[1]; }
+  // The clock position of the next victim is not tracked cheaply, so no
+  // victim is reported.
+  bool NeedsEvictionFor(size_t charge, HashVal* victim, bool* have_victim);
 
   // For reconstructing key from hashed_key. Requires the caller to provide
   // backing storage for the Slice in `unhashed`
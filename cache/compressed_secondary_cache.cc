@@ -17,9 +17,25 @@
 
 namespace ROCKSDB_NAMESPACE {
 
+namespace {
+std::shared_ptr<Cache> MakeBackingCache(
+    const CompressedSecondaryCacheOptions& opts) {
+  if (!opts.use_hyper_clock_cache) {
+    return opts.LRUCacheOptions::MakeSharedCache();
+  }
+  // Compressed entries vary widely in size, so let the table size itself
+  HyperClockCacheOptions hcc_opts(
+      opts.capacity, /*estimated_entry_charge=*/0, opts.num_shard_bits,
+      opts.strict_capacity_limit, opts.memory_allocator,
+      opts.metadata_charge_policy);
+  hcc_opts.hash_seed = opts.hash_seed;
+  return hcc_opts.MakeSharedCache();
+}
+}  // namespace
+
 CompressedSecondaryCache::CompressedSecondaryCache(
     const CompressedSecondaryCacheOptions& opts)
-    : cache_(opts.LRUCacheOptions::MakeSharedCache()),
+    : cache_(MakeBackingCache(opts)),
       cache_options_(opts),
       cache_res_mgr_(std::make_shared<ConcurrentCacheReservationManager>(
           std::make_shared<CacheReservationManagerImpl<CacheEntryRole::kMisc>>(
@@ -232,6 +248,11 @@ Status CompressedSecondaryCache::InsertInternal(
   }
 
   PERF_COUNTER_ADD(compressed_sec_cache_insert_real_count, 1);
+  if (cache_options_.use_hyper_clock_cache) {
+    // HyperClockCache does not overwrite an existing entry (such as the dummy
+    // for this key) on Insert, so make room for the real entry
+    cache_->Erase(key);
+  }
   if (cache_options_.enable_custom_split_merge) {
     size_t split_charge{0};
     CacheValueChunk* value_chunks_head = SplitValueIntoChunks(
@@ -317,6 +338,9 @@ std::string CompressedSecondaryCache::GetPrintableOptions() const {
   snprintf(buffer, kBufferSize, "    compress_format_version : %d\n",
            cache_options_.compress_format_version);
   ret.append(buffer);
+  snprintf(buffer, kBufferSize, "    use_hyper_clock_cache : %d\n",
+           cache_options_.use_hyper_clock_cache);
+  ret.append(buffer);
   return ret;
 }
 
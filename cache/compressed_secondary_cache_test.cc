@@ -845,6 +845,30 @@ TEST_P(CompressedSecondaryCacheTestWithCompressionParam,
   BasicTestHelper(sec_cache, sec_cache_is_compressed_);
 }
 
+TEST_P(CompressedSecondaryCacheTestWithCompressionParam,
+       BasicTestWithHyperClockCache) {
+  if (sec_cache_is_compressed_ && !LZ4_Supported()) {
+    ROCKSDB_GTEST_SKIP("This test requires LZ4 support.");
+    sec_cache_is_compressed_ = false;
+  }
+  for (bool split : {false, true}) {
+    CompressedSecondaryCacheOptions opts;
+    // Leave room for the HyperClockCache table metadata
+    opts.capacity = 1 << 20;
+    opts.num_shard_bits = 0;
+    opts.compression_type =
+        sec_cache_is_compressed_ ? kLZ4Compression : kNoCompression;
+    opts.enable_custom_split_merge = split;
+    opts.use_hyper_clock_cache = true;
+    std::shared_ptr<SecondaryCache> sec_cache =
+        NewCompressedSecondaryCache(opts);
+    ASSERT_NE(sec_cache->GetPrintableOptions().find(
+                  "use_hyper_clock_cache : 1"),
+              std::string::npos);
+    BasicTestHelper(sec_cache, sec_cache_is_compressed_);
+  }
+}
+
 TEST_P(CompressedSecondaryCacheTestWithCompressionParam, FailsTest) {
   FailsTest(sec_cache_is_compressed_);
 }
@@ -0,0 +1,78 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "cache/frequency_sketch.h"
+
+#include <algorithm>
+
+#include "util/math.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+namespace {
+// Odd multipliers deriving the four independent counter positions of a key
+constexpr uint64_t kProbeMultipliers[4] = {
+    0x9E3779B97F4A7C15U, 0xC2B2AE3D27D4EB4FU, 0x165667B19E3779F9U,
+    0xD6E8FEB86659FD93U};
+constexpr uint64_t kHalfMask = 0x7777777777777777U;
+}  // namespace
+
+FrequencySketch::FrequencySketch(size_t expected_entries)
+    : expected_entries_(std::max(expected_entries, size_t{16})),
+      // Sixteen 4-bit counters per word and ~8 counters per expected entry
+      word_mask_(
+          (size_t{1} << (FloorLog2(expected_entries_ - 1) + 1)) / 2 - 1),
+      sample_size_(uint64_t{10} * expected_entries_),
+      words_(new RelaxedAtomic<uint64_t>[word_mask_ + 1]) {
+  for (size_t i = 0; i <= word_mask_; ++i) {
+    words_[i].StoreRelaxed(0);
+  }
+}
+
+inline void FrequencySketch::Locate(uint64_t hash, int i, size_t* word_index,
+                                    int* shift) const {
+  uint64_t h = hash * kProbeMultipliers[i];
+  *word_index = static_cast<size_t>(h >> 24) & word_mask_;
+  *shift = static_cast<int>(h >> 60) * 4;
+}
+
+void FrequencySketch::Record(uint64_t hash) {
+  bool added = false;
+  for (int i = 0; i < 4; ++i) {
+    size_t word_index;
+    int shift;
+    Locate(hash, i, &word_index, &shift);
+    uint64_t word = words_[word_index].LoadRelaxed();
+    if (((word >> shift) & kMaxFrequency) < kMaxFrequency) {
+      added |= words_[word_index].CasWeakRelaxed(word,
+                                                 word + (uint64_t{1} << shift));
+    }
+  }
+  if (added && additions_.FetchAddRelaxed(1) + 1 == sample_size_) {
+    Age();
+  }
+}
+
+uint32_t FrequencySketch::Estimate(uint64_t hash) const {
+  uint32_t result = kMaxFrequency;
+  for (int i = 0; i < 4; ++i) {
+    size_t word_index;
+    int shift;
+    Locate(hash, i, &word_index, &shift);
+    uint64_t word = words_[word_index].LoadRelaxed();
+    result = std::min(result,
+                      static_cast<uint32_t>((word >> shift) & kMaxFrequency));
+  }
+  return result;
+}
+
+void FrequencySketch::Age() {
+  additions_.StoreRelaxed(0);
+  for (size_t i = 0; i <= word_mask_; ++i) {
+    words_[i].StoreRelaxed((words_[i].LoadRelaxed() >> 1) & kHalfMask);
+  }
+}
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,53 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "rocksdb/rocksdb_namespace.h"
+#include "util/atomic.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// A count-min sketch of 4-bit saturating counters estimating how often each
+// key (identified by a 64-bit hash) has been accessed recently, for
+// TinyLFU-style cache admission (https://arxiv.org/abs/1512.00727). Each key
+// maps to four counters and its estimate is the minimum of them. Once a
+// sample of 10x the expected number of entries has been recorded, all
+// counters are halved so that the estimates favor recent popularity.
+//
+// Thread safe. Concurrent updates are best effort: an increment racing with
+// another update to the same 64-bit word may be dropped, which is harmless
+// for an approximate frequency estimate and avoids retry loops on hot keys.
+class FrequencySketch {
+ public:
+  static constexpr uint32_t kMaxFrequency = 15;
+
+  explicit FrequencySketch(size_t expected_entries);
+
+  void Record(uint64_t hash);
+
+  uint32_t Estimate(uint64_t hash) const;
+
+  size_t GetExpectedEntries() const { return expected_entries_; }
+
+ private:
+  // Sets *word_index and *shift for counter `i` (of 4) of `hash`
+  inline void Locate(uint64_t hash, int i, size_t* word_index,
+                     int* shift) const;
+
+  // Halves all counters
+  void Age();
+
+  const size_t expected_entries_;
+  const size_t word_mask_;
+  const uint64_t sample_size_;
+  std::unique_ptr<RelaxedAtomic<uint64_t>[]> words_;
+  RelaxedAtomic<uint64_t> additions_{0};
+};
+
+}  // namespace ROCKSDB_NAMESPACE
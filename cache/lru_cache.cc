@@ -9,6 +9,7 @@
 
 #include "cache/lru_cache.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <cstdio>
@@ -119,7 +120,8 @@ LRUCacheShard::LRUCacheShard(size_t capacity, bool strict_capacity_limit,
                              CacheMetadataChargePolicy metadata_charge_policy,
                              int max_upper_hash_bits,
                              MemoryAllocator* allocator,
-                             const Cache::EvictionCallback* eviction_callback)
+                             const Cache::EvictionCallback* eviction_callback,
+                             bool adaptive_pool_ratios)
     : CacheShardBase(metadata_charge_policy),
       capacity_(0),
       high_pri_pool_usage_(0),
@@ -129,6 +131,8 @@ LRUCacheShard::LRUCacheShard(size_t capacity, bool strict_capacity_limit,
       high_pri_pool_capacity_(0),
       low_pri_pool_ratio_(low_pri_pool_ratio),
       low_pri_pool_capacity_(0),
+      adaptive_pool_ratios_(adaptive_pool_ratios),
+      ghost_length_bits_(0),
       table_(max_upper_hash_bits, allocator),
       usage_(0),
       lru_usage_(0),
@@ -331,10 +335,54 @@ void LRUCacheShard::EvictFromLRU(size_t charge,
     old->SetInCache(false);
     assert(usage_ >= old->total_charge);
     usage_ -= old->total_charge;
+    if (adaptive_pool_ratios_) {
+      RecordGhost(old);
+    }
     deleted->push_back(old);
   }
 }
 
+size_t LRUCacheShard::GhostIndex(uint32_t hash) {
+  const int length_bits = table_.GetLengthBits() + 1;
+  if (length_bits != ghost_length_bits_) {
+    // table_ only grows, and remembering about as many evicted entries as
+    // there are cached entries is enough. Drop the old ghosts on resize.
+    ghosts_.reset(new uint64_t[size_t{1} << length_bits]());
+    ghost_length_bits_ = length_bits;
+  }
+  return hash >> (32 - length_bits);
+}
+
+void LRUCacheShard::RecordGhost(const LRUHandle* e) {
+  const bool high_pri_class = e->IsHighPri() || e->HasHit();
+  ghosts_[GhostIndex(e->hash)] =
+      (uint64_t{e->hash} << 2) | (high_pri_class ? 2 : 0) | 1;
+}
+
+void LRUCacheShard::CheckGhost(const LRUHandle* e) {
+  uint64_t& ghost = ghosts_[GhostIndex(e->hash)];
+  if ((ghost & 1) == 0 || (ghost >> 2) != e->hash) {
+    return;
+  }
+  const bool high_pri_class = (ghost & 2) != 0;
+  ghost = 0;
+  if (capacity_ == 0) {
+    return;
+  }
+  // A larger pool for the class of the re-inserted entry would have kept it
+  const double min_capacity = capacity_ * kMinAdaptivePoolRatio;
+  const double max_capacity =
+      capacity_ * std::max(1.0 - kMinAdaptivePoolRatio - low_pri_pool_ratio_,
+                           kMinAdaptivePoolRatio);
+  const double charge = static_cast<double>(e->total_charge);
+  double new_capacity = high_pri_class ? high_pri_pool_capacity_ + charge
+                                       : high_pri_pool_capacity_ - charge;
+  new_capacity = std::min(std::max(new_capacity, min_capacity), max_capacity);
+  high_pri_pool_capacity_ = new_capacity;
+  high_pri_pool_ratio_ = new_capacity / capacity_;
+  MaintainPoolSize();
+}
+
 void LRUCacheShard::NotifyEvicted(
     const autovector<LRUHandle*>& evicted_handles) {
   MemoryAllocator* alloc = table_.GetAllocator();
@@ -376,6 +424,10 @@ Status LRUCacheShard::InsertItem(LRUHandle* e, LRUHandle** handle) {
   {
     DMutexLock l(mutex_);
 
+    if (adaptive_pool_ratios_) {
+      CheckGhost(e);
+    }
+
     // Free the space following strict LRU policy until enough space
     // is freed or the lru list is empty.
     EvictFromLRU(e->total_charge, &last_reference_list);
@@ -614,6 +666,19 @@ void LRUCacheShard::Erase(const Slice& key, uint32_t hash) {
   }
 }
 
+bool LRUCacheShard::NeedsEvictionFor(size_t charge, uint32_t* victim,
+                                     bool* have_victim) {
+  DMutexLock l(mutex_);
+  // Without evictable entries, inserting cannot displace anything
+  if (usage_ + charge <= capacity_ || lru_.next == &lru_) {
+    *have_victim = false;
+    return false;
+  }
+  *victim = lru_.next->hash;
+  *have_victim = true;
+  return true;
+}
+
 size_t LRUCacheShard::GetUsage() const {
   DMutexLock l(mutex_);
   return usage_;
@@ -644,6 +709,8 @@ void LRUCacheShard::AppendPrintableOptions(std::string& str) const {
              high_pri_pool_ratio_);
     snprintf(buffer + strlen(buffer), kBufferSize - strlen(buffer),
              "    low_pri_pool_ratio: %.3lf\n", low_pri_pool_ratio_);
+    snprintf(buffer + strlen(buffer), kBufferSize - strlen(buffer),
+             "    adaptive_pool_ratios: %d\n", adaptive_pool_ratios_);
   }
   str.append(buffer);
 }
@@ -656,7 +723,8 @@ LRUCache::LRUCache(const LRUCacheOptions& opts) : ShardedCache(opts) {
                            opts.high_pri_pool_ratio, opts.low_pri_pool_ratio,
                            opts.use_adaptive_mutex, opts.metadata_charge_policy,
                            /* max_upper_hash_bits */ 32 - opts.num_shard_bits,
-                           alloc, &eviction_callback_);
+                           alloc, &eviction_callback_,
+                           opts.adaptive_pool_ratios);
   });
 }
 
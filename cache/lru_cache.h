@@ -271,7 +271,8 @@ class ALIGN_AS(CACHE_LINE_SIZE) LRUCacheShard final : public CacheShardBase {
                 bool use_adaptive_mutex,
                 CacheMetadataChargePolicy metadata_charge_policy,
                 int max_upper_hash_bits, MemoryAllocator* allocator,
-                const Cache::EvictionCallback* eviction_callback);
+                const Cache::EvictionCallback* eviction_callback,
+                bool adaptive_pool_ratios = false);
 
  public:  // Type definitions expected as parameter to ShardedCache
   using HandleImpl = LRUHandle;
@@ -283,6 +284,9 @@ class ALIGN_AS(CACHE_LINE_SIZE) LRUCacheShard final : public CacheShardBase {
     return Lower32of64(GetSliceNPHash64(key, seed));
   }
 
+  // The next victim is the oldest entry on the LRU list
+  bool NeedsEvictionFor(size_t charge, uint32_t* victim, bool* have_victim);
+
   // Separate from constructor so caller can easily make an array of LRUCache
   // if current usage is more than new capacity, the function will attempt to
   // free the needed space.
@@ -294,6 +298,10 @@ class ALIGN_AS(CACHE_LINE_SIZE) LRUCacheShard final : public CacheShardBase {
   // Set percentage of capacity reserved for high-pri cache entries.
   void SetHighPriorityPoolRatio(double high_pri_pool_ratio);
 
+  // Bound for the high-pri pool ratio with adaptive_pool_ratios, and margin
+  // kept for the bottom-pri pool
+  static constexpr double kMinAdaptivePoolRatio = 0.05;
+
   // Set percentage of capacity reserved for low-pri cache entries.
   void SetLowPriorityPoolRatio(double low_pri_pool_ratio);
 
@@ -371,6 +379,16 @@ class ALIGN_AS(CACHE_LINE_SIZE) LRUCacheShard final : public CacheShardBase {
 
   void NotifyEvicted(const autovector<LRUHandle*>& evicted_handles);
 
+  // For adaptive_pool_ratios. Ghost entries are kept in a direct-mapped table
+  // twice the size of table_, each holding the hash of an evicted entry
+  // shifted left by two, a bit for whether the entry qualified for the high-pri
+  // pool, and a bit marking the slot as used. Require mutex_.
+  void RecordGhost(const LRUHandle* e);
+  // Adapts the high-pri pool size if `e` is being re-inserted soon after
+  // being evicted.
+  void CheckGhost(const LRUHandle* e);
+  size_t GhostIndex(uint32_t hash);
+
   LRUHandle* CreateHandle(const Slice& key, uint32_t hash,
                           Cache::ObjectPtr value,
                           const Cache::CacheItemHelper* helper, size_t charge);
@@ -401,6 +419,13 @@ class ALIGN_AS(CACHE_LINE_SIZE) LRUCacheShard final : public CacheShardBase {
   // Remember the value to avoid recomputing each time.
   double low_pri_pool_capacity_;
 
+  // Whether high_pri_pool_ratio_ is tuned from ghost entries
+  const bool adaptive_pool_ratios_;
+
+  // Ghost entries for adaptive_pool_ratios_, see RecordGhost()
+  std::unique_ptr<uint64_t[]> ghosts_;
+  int ghost_length_bits_;
+
   // Dummy head of LRU list.
   // lru.prev is newest entry, lru.next is oldest entry.
   // LRU contains items which can be evicted, ie reference only by cache
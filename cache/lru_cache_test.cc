@@ -2723,6 +2723,74 @@ TEST_F(LRUCacheTest, InsertAfterReducingCapacity) {
   Insert("aaa", Cache::Priority::LOW, /*charge=*/3);
 }
 
+TEST_F(LRUCacheTest, AdaptivePoolRatios) {
+  LRUCacheOptions opts(/*capacity=*/100, /*num_shard_bits=*/0,
+                       /*strict_capacity_limit=*/false,
+                       /*high_pri_pool_ratio=*/0.5);
+  opts.metadata_charge_policy = kDontChargeCacheMetadata;
+  opts.adaptive_pool_ratios = true;
+  auto key = [](const char* prefix, int i) {
+    return prefix + std::to_string(i);
+  };
+  auto lookup_or_insert = [&](Cache* cache, const std::string& k,
+                              Cache::Priority priority) {
+    Cache::Handle* handle = cache->BasicLookup(k, /*stats=*/nullptr);
+    if (handle != nullptr) {
+      cache->Release(handle);
+      return true;
+    }
+    EXPECT_OK(cache->Insert(k, /*obj=*/nullptr, &kNoopCacheItemHelper,
+                            /*charge=*/1, /*handle=*/nullptr, priority));
+    return false;
+  };
+
+  // 80 high-pri entries (like index blocks) that keep being reused, and scans
+  // of low-pri entries that are not. A fixed high-pri pool of half the cache
+  // loses part of the reused entries in every scan, while the adaptive pool
+  // grows to keep them.
+  for (bool adaptive : {false, true}) {
+    opts.adaptive_pool_ratios = adaptive;
+    std::shared_ptr<Cache> cache = opts.MakeSharedCache();
+    int hits = 0;
+    for (int round = 0; round < 20; round++) {
+      hits = 0;
+      for (int i = 0; i < 80; i++) {
+        hits += lookup_or_insert(cache.get(), key("index", i),
+                                 Cache::Priority::HIGH);
+      }
+      for (int i = 0; i < 100; i++) {
+        lookup_or_insert(cache.get(), key("scan", round * 100 + i),
+                         Cache::Priority::LOW);
+      }
+    }
+    double ratio = static_cast<LRUCache*>(cache.get())->GetHighPriPoolRatio();
+    if (adaptive) {
+      ASSERT_GT(ratio, 0.7);
+      ASSERT_GE(hits, 75);
+    } else {
+      ASSERT_EQ(ratio, 0.5);
+      ASSERT_EQ(hits, 50);
+    }
+  }
+
+  // Entries that are evicted before their first reuse shrink the high-pri pool
+  // again
+  opts.high_pri_pool_ratio = 0.9;
+  opts.adaptive_pool_ratios = true;
+  std::shared_ptr<Cache> cache = opts.MakeSharedCache();
+  for (int i = 0; i < 90; i++) {
+    lookup_or_insert(cache.get(), key("hot", i), Cache::Priority::LOW);
+    ASSERT_TRUE(
+        lookup_or_insert(cache.get(), key("hot", i), Cache::Priority::LOW));
+  }
+  for (int round = 0; round < 4; round++) {
+    for (int i = 0; i < 30; i++) {
+      lookup_or_insert(cache.get(), key("warm", i), Cache::Priority::LOW);
+    }
+  }
+  ASSERT_LT(static_cast<LRUCache*>(cache.get())->GetHighPriPoolRatio(), 0.9);
+}
+
 }  // namespace ROCKSDB_NAMESPACE
 
 int main(int argc, char** argv) {
@@ -0,0 +1,411 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "cache/nvm_secondary_cache.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+#include "util/coding.h"
+#include "util/crc32c.h"
+#include "util/hash.h"
+#include "util/mutexlock.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+class NvmSecondaryCache::ResultHandle : public SecondaryCacheResultHandle {
+ public:
+  ResultHandle(FileSystem* fs, const Slice& key,
+               const Cache::CacheItemHelper* helper,
+               Cache::CreateContext* create_context, size_t record_size)
+      : fs_(fs),
+        key_(key.ToString()),
+        helper_(helper),
+        create_context_(create_context),
+        scratch_(new char[record_size]) {
+    req_.len = record_size;
+    req_.scratch = scratch_.get();
+  }
+
+  ~ResultHandle() override {
+    if (!read_done_ && io_handle_ != nullptr) {
+      // Must not free the buffer under an outstanding read
+      std::vector<void*> io_handles{io_handle_};
+      fs_->AbortIO(io_handles).PermitUncheckedError();
+    }
+    ReleaseIOHandle();
+  }
+
+  bool IsReady() override {
+    if (!read_done_) {
+      return false;
+    }
+    Complete();
+    return true;
+  }
+
+  void Wait() override {
+    if (!read_done_ && io_handle_ != nullptr) {
+      std::vector<void*> io_handles{io_handle_};
+      fs_->Poll(io_handles, 1).PermitUncheckedError();
+    }
+    Complete();
+  }
+
+  Cache::ObjectPtr Value() override { return value_; }
+
+  size_t Size() override { return value_ ? charge_ : 0; }
+
+  bool IsReadPending() const { return !read_done_ && io_handle_ != nullptr; }
+
+  void* io_handle() const { return io_handle_; }
+
+  // Takes a copy of the record from memory instead of reading it
+  void CopyRecord(const Slice& record) {
+    assert(record.size() == req_.len);
+    std::copy(record.data(), record.data() + record.size(), scratch_.get());
+    req_.result = Slice(scratch_.get(), record.size());
+    req_.status = IOStatus::OK();
+    read_done_ = true;
+  }
+
+  // Reads the record at `offset` of `file`, asynchronously if supported
+  void StartRead(FSRandomAccessFile* file, uint64_t offset) {
+    req_.offset = offset;
+    IOOptions io_opts;
+    IOStatus s = file->ReadAsync(req_, io_opts, OnReadDone, this, &io_handle_,
+                                 &del_fn_, /*dbg=*/nullptr);
+    if (s.IsNotSupported()) {
+      req_.status = file->Read(req_.offset, req_.len, io_opts, &req_.result,
+                               req_.scratch, /*dbg=*/nullptr);
+      read_done_ = true;
+    } else if (!s.ok()) {
+      req_.status = s;
+      read_done_ = true;
+    }
+  }
+
+ private:
+  static void OnReadDone(FSReadRequest& req, void* arg) {
+    auto* handle = static_cast<ResultHandle*>(arg);
+    handle->req_.status = req.status;
+    handle->req_.result = req.result;
+    handle->read_done_ = true;
+  }
+
+  void ReleaseIOHandle() {
+    if (io_handle_ != nullptr && del_fn_) {
+      del_fn_(io_handle_);
+    }
+    io_handle_ = nullptr;
+  }
+
+  // Verifies the record and creates the object from it, once
+  void Complete() {
+    if (completed_) {
+      return;
+    }
+    completed_ = true;
+    if (!read_done_) {
+      // Poll failed; give up on the read
+      std::vector<void*> io_handles{io_handle_};
+      fs_->AbortIO(io_handles).PermitUncheckedError();
+      read_done_ = true;
+      req_.status = IOStatus::Aborted();
+    }
+    ReleaseIOHandle();
+    if (!req_.status.ok() || req_.result.size() != req_.len ||
+        req_.len < kRecordHeaderSize) {
+      return;
+    }
+    const char* p = req_.result.data();
+    uint32_t expected_crc = crc32c::Unmask(DecodeFixed32(p));
+    if (crc32c::Value(p + 4, req_.len - 4) != expected_crc) {
+      return;
+    }
+    uint32_t key_size = DecodeFixed32(p + 4);
+    uint32_t data_size = DecodeFixed32(p + 8);
+    auto type = static_cast<CompressionType>(p[12]);
+    auto source = static_cast<CacheTier>(p[13]);
+    if (kRecordHeaderSize + key_size + data_size != req_.len ||
+        Slice(p + kRecordHeaderSize, key_size) != Slice(key_)) {
+      return;
+    }
+    Slice data(p + kRecordHeaderSize + key_size, data_size);
+    Status s = helper_->create_cb(data, type, source, create_context_,
+                                  /*alloc=*/nullptr, &value_, &charge_);
+    if (!s.ok()) {
+      value_ = nullptr;
+    }
+  }
+
+  FileSystem* const fs_;
+  const std::string key_;
+  const Cache::CacheItemHelper* const helper_;
+  Cache::CreateContext* const create_context_;
+  std::unique_ptr<char[]> scratch_;
+  FSReadRequest req_;
+  void* io_handle_ = nullptr;
+  IOHandleDeleter del_fn_;
+  bool read_done_ = false;
+  bool completed_ = false;
+  Cache::ObjectPtr value_ = nullptr;
+  size_t charge_ = 0;
+};
+
+NvmSecondaryCache::NvmSecondaryCache(const NvmSecondaryCacheOptions& opts)
+    : opts_(opts),
+      fs_(opts.file_system ? opts.file_system : FileSystem::Default()),
+      region_size_(opts.region_size),
+      num_regions_(static_cast<uint32_t>(std::min(
+          opts.region_size > 0 ? opts.capacity / opts.region_size : 0,
+          size_t{UINT32_MAX}))),
+      regions_(num_regions_) {}
+
+NvmSecondaryCache::~NvmSecondaryCache() {
+  if (write_file_) {
+    write_file_->Close(IOOptions(), /*dbg=*/nullptr).PermitUncheckedError();
+  }
+}
+
+Status NvmSecondaryCache::Open() {
+  if (opts_.path.empty()) {
+    return Status::InvalidArgument("NvmSecondaryCache requires a path");
+  }
+  if (region_size_ <= kRecordHeaderSize || region_size_ > UINT32_MAX) {
+    return Status::InvalidArgument("Invalid NvmSecondaryCache region_size");
+  }
+  if (num_regions_ < 2) {
+    return Status::InvalidArgument(
+        "NvmSecondaryCache capacity must allow for at least two regions");
+  }
+  FileOptions file_opts;
+  std::unique_ptr<FSWritableFile> file;
+  IOStatus s = fs_->NewWritableFile(opts_.path, file_opts, &file,
+                                    /*dbg=*/nullptr);
+  if (s.ok()) {
+    s = file->Close(IOOptions(), /*dbg=*/nullptr);
+  }
+  if (s.ok()) {
+    s = fs_->NewRandomRWFile(opts_.path, file_opts, &write_file_,
+                             /*dbg=*/nullptr);
+  }
+  if (s.ok()) {
+    s = fs_->NewRandomAccessFile(opts_.path, file_opts, &read_file_,
+                                 /*dbg=*/nullptr);
+  }
+  if (!s.ok()) {
+    write_file_.reset();
+    read_file_.reset();
+    return s;
+  }
+  regions_[0].buffer = std::make_shared<std::string>();
+  regions_[0].buffer->reserve(region_size_);
+  return Status::OK();
+}
+
+Status NvmSecondaryCache::Insert(const Slice& key, Cache::ObjectPtr obj,
+                                 const Cache::CacheItemHelper* helper,
+                                 bool /*force_insert*/) {
+  if (!helper || !helper->IsSecondaryCacheCompatible()) {
+    return Status::OK();
+  }
+  size_t size = (*helper->size_cb)(obj);
+  std::string saved(size, '\0');
+  Status s = (*helper->saveto_cb)(obj, /*from_offset=*/0, size, &saved[0]);
+  if (!s.ok()) {
+    return s;
+  }
+  return Append(key, saved, kNoCompression, CacheTier::kVolatileTier);
+}
+
+Status NvmSecondaryCache::InsertSaved(const Slice& key, const Slice& saved,
+                                      CompressionType type, CacheTier source) {
+  return Append(key, saved, type, source);
+}
+
+Status NvmSecondaryCache::Append(const Slice& key, const Slice& saved,
+                                 CompressionType type, CacheTier source) {
+  if (!write_file_) {
+    return Status::OK();
+  }
+  size_t record_size = kRecordHeaderSize + key.size() + saved.size();
+  if (record_size > region_size_) {
+    // Not cached, as allowed for SecondaryCache
+    return Status::OK();
+  }
+  std::string record;
+  record.reserve(record_size);
+  PutFixed32(&record, 0);
+  PutFixed32(&record, static_cast<uint32_t>(key.size()));
+  PutFixed32(&record, static_cast<uint32_t>(saved.size()));
+  record.push_back(static_cast<char>(type));
+  record.push_back(static_cast<char>(source));
+  record.append(key.data(), key.size());
+  record.append(saved.data(), saved.size());
+  EncodeFixed32(&record[0], crc32c::Mask(crc32c::Value(record.data() + 4,
+                                                       record.size() - 4)));
+  uint64_t hash = GetSliceHash64(key);
+
+  std::shared_ptr<std::string> sealed;
+  uint32_t sealed_region = 0;
+  mutex_.Lock();
+  if (regions_[active_region_].buffer->size() + record.size() >
+      region_size_) {
+    sealed = regions_[active_region_].buffer;
+    sealed_region = active_region_;
+    RecycleNextRegion();
+  }
+  Region& active = regions_[active_region_];
+  index_[hash] = Location{active_region_,
+                          static_cast<uint32_t>(active.buffer->size()),
+                          static_cast<uint32_t>(record.size())};
+  active.key_hashes.push_back(hash);
+  active.buffer->append(record);
+  if (!sealed) {
+    mutex_.Unlock();
+    return Status::OK();
+  }
+
+  // Write out the sealed region without blocking lookups, which are served
+  // from its buffer until the write has finished
+  write_mutex_.Lock();
+  mutex_.Unlock();
+  IOStatus s = write_file_->Write(uint64_t{sealed_region} * region_size_,
+                                  *sealed, IOOptions(), /*dbg=*/nullptr);
+  write_mutex_.Unlock();
+
+  MutexLock l(&mutex_);
+  Region& region = regions_[sealed_region];
+  if (region.buffer == sealed) {
+    region.buffer.reset();
+    if (!s.ok()) {
+      for (uint64_t h : region.key_hashes) {
+        auto it = index_.find(h);
+        if (it != index_.end() && it->second.region == sealed_region) {
+          index_.erase(it);
+        }
+      }
+      region.key_hashes.clear();
+    }
+  }
+  return s;
+}
+
+void NvmSecondaryCache::RecycleNextRegion() {
+  mutex_.AssertHeld();
+  active_region_ = (active_region_ + 1) % num_regions_;
+  Region& region = regions_[active_region_];
+  for (uint64_t h : region.key_hashes) {
+    auto it = index_.find(h);
+    if (it != index_.end() && it->second.region == active_region_) {
+      index_.erase(it);
+    }
+  }
+  region.key_hashes.clear();
+  region.buffer = std::make_shared<std::string>();
+  region.buffer->reserve(region_size_);
+}
+
+std::unique_ptr<SecondaryCacheResultHandle> NvmSecondaryCache::Lookup(
+    const Slice& key, const Cache::CacheItemHelper* helper,
+    Cache::CreateContext* create_context, bool wait, bool /*advise_erase*/,
+    Statistics* /*stats*/, bool& kept_in_sec_cache) {
+  kept_in_sec_cache = false;
+  if (!read_file_) {
+    return nullptr;
+  }
+  uint64_t hash = GetSliceHash64(key);
+  std::unique_ptr<ResultHandle> handle;
+  uint64_t file_offset = 0;
+  {
+    MutexLock l(&mutex_);
+    auto it = index_.find(hash);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    const Location& loc = it->second;
+    handle.reset(
+        new ResultHandle(fs_.get(), key, helper, create_context, loc.size));
+    const std::shared_ptr<std::string>& buffer = regions_[loc.region].buffer;
+    if (buffer) {
+      handle->CopyRecord(Slice(buffer->data() + loc.offset, loc.size));
+    } else {
+      file_offset = uint64_t{loc.region} * region_size_ + loc.offset;
+    }
+  }
+  if (!handle->IsReady()) {
+    handle->StartRead(read_file_.get(), file_offset);
+    if (!wait && !handle->IsReady()) {
+      kept_in_sec_cache = true;
+      return handle;
+    }
+    handle->Wait();
+  }
+  if (handle->Value() == nullptr) {
+    return nullptr;
+  }
+  kept_in_sec_cache = true;
+  return handle;
+}
+
+void NvmSecondaryCache::Erase(const Slice& key) {
+  MutexLock l(&mutex_);
+  index_.erase(GetSliceHash64(key));
+}
+
+void NvmSecondaryCache::WaitAll(
+    std::vector<SecondaryCacheResultHandle*> handles) {
+  std::vector<void*> io_handles;
+  for (SecondaryCacheResultHandle* h : handles) {
+    auto* handle = static_cast<ResultHandle*>(h);
+    if (handle->IsReadPending()) {
+      io_handles.push_back(handle->io_handle());
+    }
+  }
+  if (!io_handles.empty()) {
+    fs_->Poll(io_handles, io_handles.size()).PermitUncheckedError();
+  }
+  for (SecondaryCacheResultHandle* h : handles) {
+    h->Wait();
+  }
+}
+
+Status NvmSecondaryCache::GetCapacity(size_t& capacity) {
+  capacity = region_size_ * num_regions_;
+  return Status::OK();
+}
+
+std::string NvmSecondaryCache::GetPrintableOptions() const {
+  std::string ret;
+  const int kBufferSize = 200;
+  char buffer[kBufferSize];
+  snprintf(buffer, kBufferSize, "    path : %s\n", opts_.path.c_str());
+  ret.append(buffer);
+  snprintf(buffer, kBufferSize, "    capacity : %" ROCKSDB_PRIszt "\n",
+           region_size_ * num_regions_);
+  ret.append(buffer);
+  snprintf(buffer, kBufferSize, "    region_size : %" ROCKSDB_PRIszt "\n",
+           region_size_);
+  ret.append(buffer);
+  return ret;
+}
+
+size_t NvmSecondaryCache::TEST_GetNumEntries() const {
+  MutexLock l(&mutex_);
+  return index_.size();
+}
+
+Status NewNvmSecondaryCache(const NvmSecondaryCacheOptions& opts,
+                            std::shared_ptr<SecondaryCache>* result) {
+  auto cache = std::make_shared<NvmSecondaryCache>(opts);
+  Status s = cache->Open();
+  if (s.ok()) {
+    *result = std::move(cache);
+  }
+  return s;
+}
+
+}  // namespace ROCKSDB_NAMESPACE
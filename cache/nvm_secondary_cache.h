@@ -0,0 +1,115 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "port/port.h"
+#include "rocksdb/file_system.h"
+#include "rocksdb/secondary_cache.h"
+#include "rocksdb/slice.h"
+#include "rocksdb/status.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// A SecondaryCache on local flash with a log-structured layout. See
+// NvmSecondaryCacheOptions for an overview.
+//
+// Each entry is stored as a self-describing record:
+//   fixed32: masked crc32c of the rest of the record
+//   fixed32: key size
+//   fixed32: saved data size
+//   char: CompressionType of the saved data
+//   char: CacheTier the saved data came from
+//   key, saved data
+// The key and checksum are verified on every read, so a read racing with the
+// recycling of its region is detected and treated as a miss rather than
+// returning wrong data.
+class NvmSecondaryCache : public SecondaryCache {
+ public:
+  explicit NvmSecondaryCache(const NvmSecondaryCacheOptions& opts);
+  ~NvmSecondaryCache() override;
+
+  // Creates the cache file. Must succeed before use.
+  Status Open();
+
+  const char* Name() const override { return "NvmSecondaryCache"; }
+
+  Status Insert(const Slice& key, Cache::ObjectPtr obj,
+                const Cache::CacheItemHelper* helper,
+                bool force_insert) override;
+
+  Status InsertSaved(const Slice& key, const Slice& saved, CompressionType type,
+                     CacheTier source) override;
+
+  std::unique_ptr<SecondaryCacheResultHandle> Lookup(
+      const Slice& key, const Cache::CacheItemHelper* helper,
+      Cache::CreateContext* create_context, bool wait, bool advise_erase,
+      Statistics* stats, bool& kept_in_sec_cache) override;
+
+  bool SupportForceErase() const override { return false; }
+
+  void Erase(const Slice& key) override;
+
+  void WaitAll(std::vector<SecondaryCacheResultHandle*> handles) override;
+
+  Status GetCapacity(size_t& capacity) override;
+
+  std::string GetPrintableOptions() const override;
+
+  size_t TEST_GetNumEntries() const;
+
+  static constexpr size_t kRecordHeaderSize = 14;
+
+ private:
+  class ResultHandle;
+
+  // Location of a record in the cache file
+  struct Location {
+    uint32_t region;
+    uint32_t offset;
+    uint32_t size;
+  };
+
+  struct Region {
+    // Hashes of keys whose latest record is in this region
+    std::vector<uint64_t> key_hashes;
+    // The region contents while it is being filled or written out, nullptr
+    // once it is only in the file
+    std::shared_ptr<std::string> buffer;
+  };
+
+  // Appends a record to the active region, writing out the active region
+  // first if the record does not fit.
+  Status Append(const Slice& key, const Slice& saved, CompressionType type,
+                CacheTier source);
+
+  // Starts filling the next region, dropping the index entries of its
+  // previous contents. Requires mutex_.
+  void RecycleNextRegion();
+
+  const NvmSecondaryCacheOptions opts_;
+  const std::shared_ptr<FileSystem> fs_;
+  const size_t region_size_;
+  const uint32_t num_regions_;
+  std::unique_ptr<FSRandomRWFile> write_file_;
+  std::unique_ptr<FSRandomAccessFile> read_file_;
+
+  // Protects the index and region metadata
+  mutable port::Mutex mutex_;
+  std::unordered_map<uint64_t, Location> index_;
+  std::vector<Region> regions_;
+  uint32_t active_region_ = 0;
+
+  // Serializes region writes, so that they are issued in the order the
+  // regions are sealed. Acquired while holding mutex_ (never the reverse).
+  port::Mutex write_mutex_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
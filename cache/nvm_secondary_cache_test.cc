@@ -0,0 +1,190 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "cache/nvm_secondary_cache.h"
+
+#include <memory>
+#include <string>
+
+#include "rocksdb/env.h"
+#include "rocksdb/secondary_cache.h"
+#include "test_util/testharness.h"
+#include "test_util/testutil.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+namespace {
+struct TestItem {
+  std::string data;
+  CompressionType type;
+};
+
+size_t SizeCallback(Cache::ObjectPtr obj) {
+  return static_cast<TestItem*>(obj)->data.size();
+}
+
+Status SaveToCallback(Cache::ObjectPtr from_obj, size_t from_offset,
+                      size_t length, char* out) {
+  auto* item = static_cast<TestItem*>(from_obj);
+  std::copy_n(item->data.data() + from_offset, length, out);
+  return Status::OK();
+}
+
+void DeletionCallback(Cache::ObjectPtr obj, MemoryAllocator* /*alloc*/) {
+  delete static_cast<TestItem*>(obj);
+}
+
+Status CreateCallback(const Slice& data, CompressionType type,
+                      CacheTier /*source*/, Cache::CreateContext* /*context*/,
+                      MemoryAllocator* /*allocator*/, Cache::ObjectPtr* out_obj,
+                      size_t* out_charge) {
+  *out_obj = new TestItem{data.ToString(), type};
+  *out_charge = data.size();
+  return Status::OK();
+}
+
+const Cache::CacheItemHelper kHelperWithoutSecondary{CacheEntryRole::kMisc,
+                                                     &DeletionCallback};
+const Cache::CacheItemHelper kHelper{
+    CacheEntryRole::kMisc, &DeletionCallback, &SizeCallback, &SaveToCallback,
+    &CreateCallback, &kHelperWithoutSecondary};
+}  // namespace
+
+class NvmSecondaryCacheTest : public testing::Test {
+ public:
+  NvmSecondaryCacheTest() {
+    opts_.path = test::PerThreadDBPath("nvm_secondary_cache");
+    opts_.region_size = 4096;
+    opts_.capacity = 4 * opts_.region_size;
+  }
+
+  ~NvmSecondaryCacheTest() override {
+    cache_.reset();
+    EXPECT_OK(Env::Default()->DeleteFile(opts_.path));
+  }
+
+  void Open() { ASSERT_OK(NewNvmSecondaryCache(opts_, &cache_)); }
+
+  static std::string Key(int i) {
+    // 16 bytes, like block cache keys
+    char buf[17];
+    snprintf(buf, sizeof(buf), "key%013d", i);
+    return buf;
+  }
+
+  static std::string Value(int i) {
+    return std::string(1000, static_cast<char>('a' + i % 26));
+  }
+
+  // Returns the value found for key i, or "" on a miss
+  std::string Lookup(int i, bool wait = true) {
+    bool kept_in_sec_cache = false;
+    std::unique_ptr<SecondaryCacheResultHandle> handle =
+        cache_->Lookup(Key(i), &kHelper, /*create_context=*/nullptr, wait,
+                       /*advise_erase=*/false, /*stats=*/nullptr,
+                       kept_in_sec_cache);
+    if (!handle) {
+      return "";
+    }
+    EXPECT_TRUE(kept_in_sec_cache);
+    if (!wait) {
+      cache_->WaitAll({handle.get()});
+    }
+    EXPECT_TRUE(handle->IsReady());
+    std::unique_ptr<TestItem> item(static_cast<TestItem*>(handle->Value()));
+    if (!item) {
+      return "";
+    }
+    EXPECT_EQ(item->data.size(), handle->Size());
+    return item->data;
+  }
+
+ protected:
+  NvmSecondaryCacheOptions opts_;
+  std::shared_ptr<SecondaryCache> cache_;
+};
+
+TEST_F(NvmSecondaryCacheTest, InvalidOptions) {
+  opts_.capacity = opts_.region_size;
+  ASSERT_TRUE(NewNvmSecondaryCache(opts_, &cache_).IsInvalidArgument());
+  opts_.capacity = 4 * opts_.region_size;
+  opts_.region_size = 0;
+  ASSERT_TRUE(NewNvmSecondaryCache(opts_, &cache_).IsInvalidArgument());
+  opts_.region_size = 4096;
+  ASSERT_EQ(cache_, nullptr);
+  Open();
+  size_t capacity = 0;
+  ASSERT_OK(cache_->GetCapacity(capacity));
+  ASSERT_EQ(capacity, 4 * opts_.region_size);
+}
+
+TEST_F(NvmSecondaryCacheTest, InsertAndLookup) {
+  Open();
+  ASSERT_EQ(Lookup(0), "");
+
+  // Entries in the active region are served from memory
+  TestItem item{Value(0), kNoCompression};
+  ASSERT_OK(cache_->Insert(Key(0), &item, &kHelper, /*force_insert=*/false));
+  ASSERT_OK(cache_->InsertSaved(Key(1), Value(1), kLZ4Compression,
+                                CacheTier::kVolatileTier));
+  ASSERT_EQ(Lookup(0), Value(0));
+  ASSERT_EQ(Lookup(1), Value(1));
+
+  // Filling more regions writes the earlier ones to the file
+  for (int i = 2; i < 10; i++) {
+    ASSERT_OK(cache_->InsertSaved(Key(i), Value(i)));
+  }
+  for (int i = 0; i < 10; i++) {
+    ASSERT_EQ(Lookup(i), Value(i));
+    ASSERT_EQ(Lookup(i, /*wait=*/false), Value(i));
+  }
+
+  // The compression type is kept
+  bool kept_in_sec_cache = false;
+  auto handle = cache_->Lookup(Key(1), &kHelper, nullptr, /*wait=*/true,
+                               /*advise_erase=*/false, nullptr,
+                               kept_in_sec_cache);
+  ASSERT_NE(handle, nullptr);
+  std::unique_ptr<TestItem> found(static_cast<TestItem*>(handle->Value()));
+  ASSERT_EQ(found->type, kLZ4Compression);
+
+  cache_->Erase(Key(3));
+  ASSERT_EQ(Lookup(3), "");
+
+  // Entries that cannot fit in a region are not cached
+  ASSERT_OK(cache_->InsertSaved(Key(100), std::string(5000, 'x')));
+  ASSERT_EQ(Lookup(100), "");
+}
+
+TEST_F(NvmSecondaryCacheTest, FifoRegionEviction) {
+  Open();
+  // Three entries fit in each of the four regions
+  const int kNumEntries = 40;
+  for (int i = 0; i < kNumEntries; i++) {
+    ASSERT_OK(cache_->InsertSaved(Key(i), Value(i)));
+  }
+  auto* nvm_cache = static_cast<NvmSecondaryCache*>(cache_.get());
+  ASSERT_LE(nvm_cache->TEST_GetNumEntries(), 12U);
+
+  // The oldest entries were evicted with their regions, the newest are kept
+  for (int i = 0; i < kNumEntries - 12; i++) {
+    ASSERT_EQ(Lookup(i), "");
+  }
+  for (int i = kNumEntries - 9; i < kNumEntries; i++) {
+    ASSERT_EQ(Lookup(i), Value(i));
+  }
+
+  // Re-inserted entries are found at their newest location
+  ASSERT_OK(cache_->InsertSaved(Key(kNumEntries - 1), Value(0)));
+  ASSERT_EQ(Lookup(kNumEntries - 1), Value(0));
+}
+
+}  // namespace ROCKSDB_NAMESPACE
+
+int main(int argc, char** argv) {
+  ROCKSDB_NAMESPACE::port::InstallStackTraceHandler();
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,201 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "cache/partitioned_cache.h"
+
+#include <algorithm>
+
+#include "util/cast_util.h"
+#include "util/mutexlock.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+PartitionedCacheCoordinator::PartitionedCacheCoordinator(
+    size_t total_capacity, std::vector<std::shared_ptr<Cache>>&& caches,
+    std::vector<size_t>&& min_capacities, std::vector<size_t>&& max_capacities)
+    : caches_(std::move(caches)),
+      min_capacities_(std::move(min_capacities)),
+      max_capacities_(std::move(max_capacities)),
+      grow_granularity_(std::max(total_capacity >> 10, size_t{1})),
+      capacities_(new std::atomic<size_t>[caches_.size()]),
+      unassigned_(total_capacity) {
+  for (size_t i = 0; i < caches_.size(); i++) {
+    assert(min_capacities_[i] <= unassigned_);
+    unassigned_ -= min_capacities_[i];
+    SetCapacity(i, min_capacities_[i]);
+  }
+}
+
+void PartitionedCacheCoordinator::Reserve(size_t i, size_t charge) {
+  const Cache& cache = *caches_[i];
+  size_t capacity = GetCapacity(i);
+  if (capacity >= max_capacities_[i] || cache.GetUsage() + charge <= capacity) {
+    return;
+  }
+
+  MutexLock l(&mutex_);
+  capacity = GetCapacity(i);
+  const size_t wanted = cache.GetUsage() + charge;
+  if (wanted <= capacity) {
+    return;
+  }
+  const size_t target =
+      std::min(std::max(wanted, capacity + grow_granularity_),
+               max_capacities_[i]);
+  if (target <= capacity) {
+    return;
+  }
+  const size_t needed = target - capacity;
+  size_t granted = std::min(needed, unassigned_);
+  unassigned_ -= granted;
+
+  const size_t n = caches_.size();
+  for (size_t k = 0; k < n && granted < needed; k++) {
+    size_t j = (next_victim_ + k) % n;
+    if (j != i) {
+      granted += Shrink(j, caches_[j]->GetUsage(), needed - granted);
+    }
+  }
+  if (capacity + granted < min_capacities_[i]) {
+    const size_t min_needed =
+        std::min(min_capacities_[i], target) - capacity - granted;
+    size_t evicted = 0;
+    for (size_t k = 0; k < n && evicted < min_needed; k++) {
+      size_t j = (next_victim_ + k) % n;
+      if (j != i) {
+        evicted += Shrink(j, min_capacities_[j], min_needed - evicted);
+      }
+    }
+    granted += evicted;
+  }
+  next_victim_ = (next_victim_ + 1) % n;
+
+  if (granted > 0) {
+    SetCapacity(i, capacity + granted);
+  }
+}
+
+size_t PartitionedCacheCoordinator::Shrink(size_t j, size_t floor,
+                                           size_t needed) {
+  mutex_.AssertHeld();
+  size_t capacity = GetCapacity(j);
+  if (capacity <= floor) {
+    return 0;
+  }
+  size_t taken = std::min(capacity - floor, needed);
+  SetCapacity(j, capacity - taken);
+  return taken;
+}
+
+void PartitionedCacheCoordinator::SetCapacity(size_t i, size_t capacity) {
+  capacities_[i].store(capacity, std::memory_order_relaxed);
+  caches_[i]->SetCapacity(capacity);
+}
+
+PartitionCache::PartitionCache(
+    std::shared_ptr<PartitionedCacheCoordinator> coordinator, size_t partition)
+    : CacheWrapper(coordinator->GetCache(partition)),
+      coordinator_(std::move(coordinator)),
+      partition_(partition) {}
+
+Status PartitionCache::Insert(const Slice& key, ObjectPtr value,
+                              const CacheItemHelper* helper, size_t charge,
+                              Handle** handle, Priority priority,
+                              const Slice& compressed_value,
+                              CompressionType type) {
+  coordinator_->Reserve(partition_, charge);
+  return target_->Insert(key, value, helper, charge, handle, priority,
+                         compressed_value, type);
+}
+
+Cache::Handle* PartitionCache::CreateStandalone(const Slice& key,
+                                                ObjectPtr obj,
+                                                const CacheItemHelper* helper,
+                                                size_t charge,
+                                                bool allow_uncharged) {
+  coordinator_->Reserve(partition_, charge);
+  return target_->CreateStandalone(key, obj, helper, charge, allow_uncharged);
+}
+
+PartitionedCacheImpl::PartitionedCacheImpl(
+    std::shared_ptr<PartitionedCacheCoordinator> coordinator)
+    : coordinator_(std::move(coordinator)) {
+  for (size_t i = 0; i < coordinator_->NumPartitions(); i++) {
+    partitions_.push_back(std::make_shared<PartitionCache>(coordinator_, i));
+  }
+}
+
+Status NewPartitionedCache(const PartitionedCacheOptions& opts,
+                           std::shared_ptr<PartitionedCache>* cache) {
+  if (cache == nullptr) {
+    return Status::InvalidArgument("cache must be non-null");
+  }
+  if (opts.cache_opts == nullptr) {
+    return Status::InvalidArgument("cache_opts must be set");
+  }
+  if (opts.partitions.empty()) {
+    return Status::InvalidArgument("partitions must not be empty");
+  }
+  double total_min_share = 0.0;
+  for (const auto& partition : opts.partitions) {
+    if (!(partition.min_share >= 0.0 &&
+          partition.min_share <= partition.max_share &&
+          partition.max_share <= 1.0)) {
+      return Status::InvalidArgument(
+          "Partition shares must satisfy 0 <= min_share <= max_share <= 1");
+    }
+    total_min_share += partition.min_share;
+  }
+  // Allow for rounding errors in shares that add up to 1
+  if (total_min_share > 1.0 + 1e-9) {
+    return Status::InvalidArgument("Sum of min_share exceeds 1");
+  }
+
+  const double total = static_cast<double>(opts.total_capacity);
+  std::vector<std::shared_ptr<Cache>> caches;
+  std::vector<size_t> min_capacities;
+  std::vector<size_t> max_capacities;
+  size_t total_min_capacity = 0;
+  for (const auto& partition : opts.partitions) {
+    // Never more than total_capacity in total, despite rounding
+    size_t min_capacity =
+        std::min(static_cast<size_t>(partition.min_share * total),
+                 opts.total_capacity - total_min_capacity);
+    total_min_capacity += min_capacity;
+    min_capacities.push_back(min_capacity);
+    max_capacities.push_back(
+        static_cast<size_t>(partition.max_share * total));
+
+    // Created with the maximum capacity, which the sharding is based on
+    std::shared_ptr<Cache> partition_cache;
+    if (opts.cache_type == PrimaryCacheType::kCacheTypeLRU) {
+      LRUCacheOptions cache_opts =
+          *(static_cast_with_check<LRUCacheOptions, ShardedCacheOptions>(
+              opts.cache_opts));
+      cache_opts.capacity = max_capacities.back();
+      partition_cache = cache_opts.MakeSharedCache();
+    } else if (opts.cache_type == PrimaryCacheType::kCacheTypeHCC) {
+      HyperClockCacheOptions cache_opts =
+          *(static_cast_with_check<HyperClockCacheOptions,
+                                   ShardedCacheOptions>(opts.cache_opts));
+      cache_opts.capacity = max_capacities.back();
+      partition_cache = cache_opts.MakeSharedCache();
+    } else {
+      return Status::InvalidArgument("Unsupported cache_type");
+    }
+    if (partition_cache == nullptr) {
+      return Status::InvalidArgument("Invalid cache_opts");
+    }
+    caches.push_back(std::move(partition_cache));
+  }
+
+  auto coordinator = std::make_shared<PartitionedCacheCoordinator>(
+      opts.total_capacity, std::move(caches), std::move(min_capacities),
+      std::move(max_capacities));
+  cache->reset(new PartitionedCacheImpl(std::move(coordinator)));
+  return Status::OK();
+}
+
+}  // namespace ROCKSDB_NAMESPACE
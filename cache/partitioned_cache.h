@@ -0,0 +1,121 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "port/port.h"
+#include "rocksdb/advanced_cache.h"
+#include "rocksdb/cache.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// Divides the total capacity of a PartitionedCache among the caches of its
+// partitions, which start at their minimum capacity. When an insert would
+// exceed the capacity of a partition below its maximum, the partition grows
+// by taking, in order:
+// 1. Capacity not yet assigned to any partition
+// 2. Capacity other partitions have above their usage, i.e. idle capacity,
+//    even if that takes them below their minimum
+// 3. Only up to its own minimum, capacity other partitions have borrowed
+//    above their minimum, evicting their entries
+// Otherwise the partition evicts its own entries as a standalone cache would.
+class PartitionedCacheCoordinator {
+ public:
+  PartitionedCacheCoordinator(size_t total_capacity,
+                              std::vector<std::shared_ptr<Cache>>&& caches,
+                              std::vector<size_t>&& min_capacities,
+                              std::vector<size_t>&& max_capacities);
+
+  // Grows partition `i`, if allowed, so that it can fit an additional entry
+  // of `charge` without evicting its own entries.
+  void Reserve(size_t i, size_t charge);
+
+  size_t GetCapacity(size_t i) const {
+    return capacities_[i].load(std::memory_order_relaxed);
+  }
+
+  const std::shared_ptr<Cache>& GetCache(size_t i) const {
+    return caches_[i];
+  }
+
+  size_t NumPartitions() const { return caches_.size(); }
+
+ private:
+  // Lowers the capacity of partition `j` by up to `needed`, but not below
+  // `floor`. Returns the capacity taken. Requires mutex_.
+  size_t Shrink(size_t j, size_t floor, size_t needed);
+
+  void SetCapacity(size_t i, size_t capacity);
+
+  const std::vector<std::shared_ptr<Cache>> caches_;
+  const std::vector<size_t> min_capacities_;
+  const std::vector<size_t> max_capacities_;
+  // Minimum growth of a partition, so that a partition filling up does not
+  // take mutex_ on every insert
+  const size_t grow_granularity_;
+
+  port::Mutex mutex_;
+  // Written only with mutex_ held
+  std::unique_ptr<std::atomic<size_t>[]> capacities_;
+  // Capacity not assigned to any partition. Protected by mutex_.
+  size_t unassigned_;
+  // Where the next search for capacity to take starts, so that it is not
+  // always taken from the same partitions. Protected by mutex_.
+  size_t next_victim_ = 0;
+};
+
+// The cache of one partition of a PartitionedCache
+class PartitionCache : public CacheWrapper {
+ public:
+  PartitionCache(std::shared_ptr<PartitionedCacheCoordinator> coordinator,
+                 size_t partition);
+
+  static const char* kClassName() { return "PartitionCache"; }
+  const char* Name() const override { return kClassName(); }
+
+  Status Insert(
+      const Slice& key, ObjectPtr value, const CacheItemHelper* helper,
+      size_t charge, Handle** handle = nullptr,
+      Priority priority = Priority::LOW,
+      const Slice& compressed_value = Slice(),
+      CompressionType type = CompressionType::kNoCompression) override;
+
+  Handle* CreateStandalone(const Slice& key, ObjectPtr obj,
+                           const CacheItemHelper* helper, size_t charge,
+                           bool allow_uncharged) override;
+
+  // Capacity is managed by the coordinator
+  void SetCapacity(size_t /*capacity*/) override {}
+
+ private:
+  const std::shared_ptr<PartitionedCacheCoordinator> coordinator_;
+  const size_t partition_;
+};
+
+class PartitionedCacheImpl : public PartitionedCache {
+ public:
+  explicit PartitionedCacheImpl(
+      std::shared_ptr<PartitionedCacheCoordinator> coordinator);
+
+  std::shared_ptr<Cache> GetPartition(size_t i) const override {
+    return partitions_[i];
+  }
+
+  size_t NumPartitions() const override { return partitions_.size(); }
+
+  size_t GetPartitionCapacity(size_t i) const override {
+    return coordinator_->GetCapacity(i);
+  }
+
+ private:
+  const std::shared_ptr<PartitionedCacheCoordinator> coordinator_;
+  std::vector<std::shared_ptr<Cache>> partitions_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
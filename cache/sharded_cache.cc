@@ -62,6 +62,10 @@ ShardedCacheBase::ShardedCacheBase(const ShardedCacheOptions& opts)
       last_id_(1),
       shard_mask_((uint32_t{1} << opts.num_shard_bits) - 1),
       hash_seed_(DetermineSeed(opts.hash_seed)),
+      frequency_sketch_(opts.frequency_admission_entries > 0
+                            ? std::make_unique<FrequencySketch>(
+                                  opts.frequency_admission_entries)
+                            : nullptr),
       strict_capacity_limit_(opts.strict_capacity_limit),
       capacity_(opts.capacity) {}
 
@@ -122,6 +126,10 @@ std::string ShardedCacheBase::GetPrintableOptions() const {
   snprintf(buffer, kBufferSize, "    memory_allocator : %s\n",
            memory_allocator() ? memory_allocator()->Name() : "None");
   ret.append(buffer);
+  snprintf(buffer, kBufferSize,
+           "    frequency_admission_entries : %" ROCKSDB_PRIszt "\n",
+           frequency_sketch_ ? frequency_sketch_->GetExpectedEntries() : 0);
+  ret.append(buffer);
   AppendPrintableOptions(ret);
   return ret;
 }
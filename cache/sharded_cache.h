@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <string>
 
+#include "cache/frequency_sketch.h"
 #include "port/lang.h"
 #include "port/port.h"
 #include "rocksdb/advanced_cache.h"
@@ -41,6 +42,18 @@ class CacheShardBase {
     return Lower32of64(hash);
   }
   void AppendPrintableOptions(std::string& /*str*/) const {}
+  // For ShardedCacheOptions::frequency_admission_entries: the hash bits to
+  // key the frequency sketch with.
+  static inline uint64_t HashForAdmission(HashCref hash) { return hash; }
+  // For ShardedCacheOptions::frequency_admission_entries: returns whether an
+  // entry of `charge` can only be inserted by evicting other entries. If so
+  // and the shard can cheaply tell which entry would be evicted first, its
+  // hash is stored in *victim and *have_victim is set to true.
+  bool NeedsEvictionFor(size_t /*charge*/, HashVal* /*victim*/,
+                        bool* have_victim) {
+    *have_victim = false;
+    return false;
+  }
 
   // Must be provided for concept CacheShard (TODO with C++20 support)
   /*
@@ -117,6 +130,8 @@ class ShardedCacheBase : public Cache {
   std::atomic<uint64_t> last_id_;  // For NewId
   const uint32_t shard_mask_;
   const uint32_t hash_seed_;
+  // See ShardedCacheOptions::frequency_admission_entries (nullptr if disabled)
+  const std::unique_ptr<FrequencySketch> frequency_sketch_;
 
   // Dynamic configuration parameters, guarded by config_mutex_
   bool strict_capacity_limit_;
@@ -181,8 +196,24 @@ class ShardedCache : public ShardedCacheBase {
     assert(helper);
     HashVal hash = CacheShard::ComputeHash(key, hash_seed_);
     auto h_out = reinterpret_cast<HandleImpl**>(handle);
-    return GetShard(hash).Insert(key, hash, obj, helper, charge, h_out,
-                                 priority);
+    CacheShard& shard = GetShard(hash);
+    if (frequency_sketch_ && !Admit(shard, hash, charge)) {
+      if (h_out == nullptr) {
+        // As if inserted and immediately evicted
+        if (helper->del_cb) {
+          helper->del_cb(obj, memory_allocator());
+        }
+        return Status::OK();
+      }
+      // Uncharged, so that the rejected entry does not evict others
+      *h_out = shard.CreateStandalone(key, hash, obj, helper, /*charge=*/0,
+                                      /*allow_uncharged=*/true);
+      if (*h_out != nullptr) {
+        return Status::OK();
+      }
+      // Otherwise, let the shard handle (and report) the failure
+    }
+    return shard.Insert(key, hash, obj, helper, charge, h_out, priority);
   }
 
   Handle* CreateStandalone(const Slice& key, ObjectPtr obj,
@@ -200,6 +231,9 @@ class ShardedCache : public ShardedCacheBase {
                  Priority priority = Priority::LOW,
                  Statistics* stats = nullptr) override {
     HashVal hash = CacheShard::ComputeHash(key, hash_seed_);
+    if (frequency_sketch_) {
+      frequency_sketch_->Record(CacheShard::HashForAdmission(hash));
+    }
     HandleImpl* result = GetShard(hash).Lookup(key, hash, helper,
                                                create_context, priority, stats);
     return static_cast<Handle*>(result);
@@ -311,6 +345,24 @@ class ShardedCache : public ShardedCacheBase {
   }
 
  private:
+  // The admission decision for ShardedCacheOptions::frequency_admission_entries
+  bool Admit(CacheShard& shard, HashCref hash, size_t charge) {
+    HashVal victim{};
+    bool have_victim = false;
+    if (!shard.NeedsEvictionFor(charge, &victim, &have_victim)) {
+      return true;
+    }
+    uint32_t freq =
+        frequency_sketch_->Estimate(CacheShard::HashForAdmission(hash));
+    if (have_victim) {
+      return freq >
+             frequency_sketch_->Estimate(CacheShard::HashForAdmission(victim));
+    }
+    return freq >= kMinFrequencyToAdmitWithoutVictim;
+  }
+
+  static constexpr uint32_t kMinFrequencyToAdmitWithoutVictim = 2;
+
   CacheShard* const shards_;
   bool destroy_shards_in_dtor_;
 };
@@ -79,6 +79,12 @@ class ArenaWrappedDBIter : public Iterator {
     MaybeAutoRefresh(false /* is_seek */, DBIter::kForward);
   }
 
+  void NextBatch(size_t max_entries, size_t max_bytes,
+                 IteratorBatch* batch) override {
+    db_iter_->NextBatch(max_entries, max_bytes, batch);
+    MaybeAutoRefresh(false /* is_seek */, DBIter::kForward);
+  }
+
   void Prev() override {
     db_iter_->Prev();
     MaybeAutoRefresh(false /* is_seek */, DBIter::kReverse);
@@ -0,0 +1,127 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "db/block_cache_manifest.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "util/coding.h"
+#include "util/crc32c.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+void EncodeBlockCacheManifest(
+    const std::vector<BlockCacheManifestEntry>& entries, std::string* dst) {
+  const size_t start = dst->size();
+  PutFixed32(dst, kBlockCacheManifestMagic);
+  PutVarint64(dst, entries.size());
+  for (const auto& entry : entries) {
+    PutVarint32(dst, entry.cf_id);
+    PutVarint64(dst, entry.file_number);
+    PutVarint64(dst, entry.offset);
+    dst->push_back(static_cast<char>(entry.role));
+  }
+  PutFixed32(dst, crc32c::Mask(crc32c::Value(dst->data() + start,
+                                             dst->size() - start)));
+}
+
+Status DecodeBlockCacheManifest(const Slice& src,
+                                std::vector<BlockCacheManifestEntry>* entries) {
+  entries->clear();
+  if (src.size() < 2 * sizeof(uint32_t) ||
+      DecodeFixed32(src.data()) != kBlockCacheManifestMagic) {
+    return Status::Corruption("Not a block cache manifest");
+  }
+  const size_t body_size = src.size() - sizeof(uint32_t);
+  if (crc32c::Unmask(DecodeFixed32(src.data() + body_size)) !=
+      crc32c::Value(src.data(), body_size)) {
+    return Status::Corruption("Block cache manifest checksum mismatch");
+  }
+  Slice input(src.data() + sizeof(uint32_t), body_size - sizeof(uint32_t));
+  uint64_t num_entries = 0;
+  if (!GetVarint64(&input, &num_entries)) {
+    return Status::Corruption("Truncated block cache manifest");
+  }
+  for (uint64_t i = 0; i < num_entries; i++) {
+    BlockCacheManifestEntry entry;
+    if (!GetVarint32(&input, &entry.cf_id) ||
+        !GetVarint64(&input, &entry.file_number) ||
+        !GetVarint64(&input, &entry.offset) || input.empty()) {
+      return Status::Corruption("Truncated block cache manifest");
+    }
+    entry.role = static_cast<CacheEntryRole>(input[0]);
+    input.remove_prefix(1);
+    if (entry.role >= CacheEntryRole::kMisc) {
+      return Status::Corruption("Unknown block role in block cache manifest");
+    }
+    entries->push_back(entry);
+  }
+  if (!input.empty()) {
+    return Status::Corruption("Trailing data in block cache manifest");
+  }
+  return Status::OK();
+}
+
+void BlockCacheManifestBuilder::AddFile(
+    uint32_t cf_id, int level, uint64_t file_number,
+    const OffsetableCacheKey& base_cache_key) {
+  files_[base_cache_key.CommonPrefixSlice().ToString()] =
+      FileInfo{cf_id, level, file_number, base_cache_key};
+}
+
+void BlockCacheManifestBuilder::AddCachedBlocks(Cache* cache) {
+  if (files_.empty()) {
+    return;
+  }
+  std::string prefix;
+  cache->ApplyToAllEntries(
+      [&](const Slice& key, Cache::ObjectPtr /*obj*/, size_t /*charge*/,
+          const Cache::CacheItemHelper* helper) {
+        if (helper == nullptr || key.size() != kCacheKeySize) {
+          return;
+        }
+        switch (helper->role) {
+          case CacheEntryRole::kDataBlock:
+          case CacheEntryRole::kFilterBlock:
+          case CacheEntryRole::kFilterMetaBlock:
+          case CacheEntryRole::kIndexBlock:
+            break;
+          default:
+            return;
+        }
+        prefix.assign(key.data(), OffsetableCacheKey::kCommonPrefixSize);
+        auto it = files_.find(prefix);
+        if (it == files_.end()) {
+          // Some other DB or an obsolete file
+          return;
+        }
+        // See BlockBasedTable::GetCacheKey()
+        uint64_t offset = it->second.base_cache_key.OffsetOfKey(key) << 2;
+        blocks_.push_back(Block{&it->second, offset, helper->role});
+      },
+      Cache::ApplyToAllEntriesOptions());
+}
+
+std::vector<BlockCacheManifestEntry> BlockCacheManifestBuilder::Finish() {
+  std::sort(blocks_.begin(), blocks_.end(),
+            [](const Block& a, const Block& b) {
+              return std::make_tuple(a.file->level, a.file->cf_id,
+                                     a.file->file_number, a.offset) <
+                     std::make_tuple(b.file->level, b.file->cf_id,
+                                     b.file->file_number, b.offset);
+            });
+  std::vector<BlockCacheManifestEntry> entries;
+  entries.reserve(blocks_.size());
+  for (const Block& block : blocks_) {
+    entries.push_back(BlockCacheManifestEntry{
+        block.file->cf_id, block.file->file_number, block.offset, block.role});
+  }
+  blocks_.clear();
+  return entries;
+}
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,83 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "cache/cache_key.h"
+#include "rocksdb/advanced_cache.h"
+#include "rocksdb/slice.h"
+#include "rocksdb/status.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// A block cache manifest lists the SST file blocks found in the block cache
+// by location rather than by contents, so that a reopened DB can read them
+// back from its SST files to warm its block cache. See
+// DBOptions::block_cache_manifest_period_sec.
+//
+// Format:
+//   fixed32: kBlockCacheManifestMagic
+//   varint64: number of entries
+//   each entry:
+//     varint32: column family ID
+//     varint64: SST file number
+//     varint64: block offset in the file
+//     char: CacheEntryRole of the block
+//   fixed32: masked crc32c of all the above
+struct BlockCacheManifestEntry {
+  uint32_t cf_id = 0;
+  uint64_t file_number = 0;
+  uint64_t offset = 0;
+  CacheEntryRole role = CacheEntryRole::kMisc;
+};
+
+constexpr uint32_t kBlockCacheManifestMagic = 0xBC3A4F01;
+
+void EncodeBlockCacheManifest(
+    const std::vector<BlockCacheManifestEntry>& entries, std::string* dst);
+
+Status DecodeBlockCacheManifest(const Slice& src,
+                                std::vector<BlockCacheManifestEntry>* entries);
+
+// Collects the cached blocks of a set of SST files into manifest entries.
+class BlockCacheManifestBuilder {
+ public:
+  // Registers an SST file with the base cache key of its block cache keys.
+  void AddFile(uint32_t cf_id, int level, uint64_t file_number,
+               const OffsetableCacheKey& base_cache_key);
+
+  // Lists the blocks of the registered files that are in `cache`.
+  void AddCachedBlocks(Cache* cache);
+
+  // Returns the entries in the order they should be reloaded: files from
+  // the lower (more recently written and more frequently read) levels
+  // first, and the blocks of each file in file order.
+  std::vector<BlockCacheManifestEntry> Finish();
+
+ private:
+  struct FileInfo {
+    uint32_t cf_id;
+    int level;
+    uint64_t file_number;
+    OffsetableCacheKey base_cache_key;
+  };
+  struct Block {
+    const FileInfo* file;
+    uint64_t offset;
+    CacheEntryRole role;
+  };
+
+  // Keyed by the common cache key prefix of the file
+  std::unordered_map<std::string, FileInfo> files_;
+  std::vector<Block> blocks_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -20,6 +20,7 @@
 #include "db/blob/blob_source.h"
 #include "db/compaction/compaction_picker.h"
 #include "db/compaction/compaction_picker_fifo.h"
+#include "db/compaction/compaction_picker_hybrid.h"
 #include "db/compaction/compaction_picker_level.h"
 #include "db/compaction/compaction_picker_universal.h"
 #include "db/db_impl/db_impl.h"
@@ -40,6 +41,7 @@
 #include "util/autovector.h"
 #include "util/cast_util.h"
 #include "util/compression.h"
+#include "util/vector_iterator.h"
 
 namespace ROCKSDB_NAMESPACE {
 
@@ -506,6 +508,71 @@ void SuperVersion::Cleanup() {
   cfd->UnrefAndTryDelete();
 }
 
+FragmentedRangeTombstoneList* SuperVersion::GetRangeTombstoneIndex() {
+  std::call_once(range_tombstone_index_once_, [this]() {
+    const InternalKeyComparator& icmp = cfd->internal_comparator();
+    const Comparator* ucmp = icmp.user_comparator();
+    assert(ucmp == BytewiseComparator());
+    // Not limited to any snapshot, as lookups at every snapshot share it
+    ReadOptions read_options;
+    std::vector<std::string> keys;
+    std::vector<std::string> values;
+    auto add_tombstones = [&](FragmentedRangeTombstoneIterator* iter,
+                              const Slice* smallest, const Slice* limit) {
+      for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+        Slice start = iter->start_key();
+        Slice end = iter->end_key();
+        if (smallest != nullptr && ucmp->Compare(start, *smallest) < 0) {
+          start = *smallest;
+        }
+        if (limit != nullptr && ucmp->Compare(end, *limit) > 0) {
+          end = *limit;
+        }
+        if (ucmp->Compare(start, end) < 0) {
+          keys.push_back(
+              InternalKey(start, iter->seq(), kTypeRangeDeletion).Encode()
+                  .ToString());
+          values.push_back(end.ToString());
+        }
+      }
+    };
+
+    std::vector<std::unique_ptr<FragmentedRangeTombstoneIterator>> imm_iters;
+    imm->AddRangeTombstoneIterators(read_options, &imm_iters);
+    for (auto& iter : imm_iters) {
+      add_tombstones(iter.get(), nullptr, nullptr);
+    }
+    const VersionStorageInfo* vstorage = current->storage_info();
+    for (int level = 0; level < vstorage->num_non_empty_levels(); level++) {
+      for (FileMetaData* f : vstorage->LevelFiles(level)) {
+        std::unique_ptr<FragmentedRangeTombstoneIterator> iter;
+        Status s = cfd->table_cache()->GetRangeTombstoneIterator(
+            read_options, icmp, *f, mutable_cf_options, &iter);
+        if (!s.ok()) {
+          // Lookups fall back to searching each file
+          s.PermitUncheckedError();
+          return;
+        }
+        if (iter == nullptr) {
+          continue;
+        }
+        // With the bytewise comparator, the key right after the largest user
+        // key
+        std::string limit = f->largest.user_key().ToString();
+        limit.push_back('\0');
+        const Slice smallest = f->smallest.user_key();
+        const Slice limit_slice = limit;
+        add_tombstones(iter.get(), &smallest, &limit_slice);
+      }
+    }
+    range_tombstone_index_.reset(new FragmentedRangeTombstoneList(
+        std::make_unique<VectorIterator>(std::move(keys), std::move(values),
+                                         &icmp),
+        icmp));
+  });
+  return range_tombstone_index_.get();
+}
+
 void SuperVersion::Init(
     ColumnFamilyData* new_cfd, MemTable* new_mem, MemTableListVersion* new_imm,
     Version* new_current,
@@ -515,6 +582,7 @@ void SuperVersion::Init(
   imm = new_imm;
   current = new_current;
   full_history_ts_low = cfd->GetFullHistoryTsLow();
+  external_write_generation = cfd->GetExternalWriteGeneration();
   seqno_to_time_mapping = std::move(new_seqno_to_time_mapping);
   cfd->Ref();
   mem->Ref();
@@ -646,6 +714,9 @@ ColumnFamilyData::ColumnFamilyData(
     } else if (ioptions_.compaction_style == kCompactionStyleFIFO) {
       compaction_picker_.reset(
           new FIFOCompactionPicker(ioptions_, &internal_comparator_));
+    } else if (ioptions_.compaction_style == kCompactionStyleHybrid) {
+      compaction_picker_.reset(
+          new HybridCompactionPicker(ioptions_, &internal_comparator_));
     } else if (ioptions_.compaction_style == kCompactionStyleNone) {
       compaction_picker_.reset(
           new NullCompactionPicker(ioptions_, &internal_comparator_));
@@ -1528,6 +1599,12 @@ Status ColumnFamilyData::ValidateOptions(
           "The garbage ratio threshold for forcing blob garbage collection "
           "should be in the range [0.0, 1.0].");
     }
+    if (cf_options.blob_garbage_collection_file_threshold < 0.0 ||
+        cf_options.blob_garbage_collection_file_threshold > 1.0) {
+      return Status::InvalidArgument(
+          "The per-file garbage ratio threshold for blob garbage collection "
+          "should be in the range [0.0, 1.0].");
+    }
   }
 
   if (cf_options.compaction_style == kCompactionStyleFIFO &&
@@ -1589,6 +1666,28 @@ Status ColumnFamilyData::ValidateOptions(
           "level0_file_num_compaction_trigger.");
     }
   }
+
+  if (cf_options.compaction_style == kCompactionStyleHybrid) {
+    const CompactionOptionsHybrid& hybrid =
+        cf_options.compaction_options_hybrid;
+    if (hybrid.size_ratio < 2) {
+      return Status::NotSupported(
+          "CompactionOptionsHybrid::size_ratio should be at least 2.");
+    }
+    if (hybrid.num_leveled_levels != 1 && hybrid.num_leveled_levels != 2) {
+      return Status::NotSupported(
+          "CompactionOptionsHybrid::num_leveled_levels should be 1 or 2.");
+    }
+    // At least L0 and one tiered level above the leveled levels, plus the
+    // reserved last level when ingest behind is allowed.
+    int min_num_levels = hybrid.num_leveled_levels + 2 +
+                         (db_options.allow_ingest_behind ? 1 : 0);
+    if (cf_options.num_levels < min_num_levels) {
+      return Status::NotSupported(
+          "Hybrid compaction requires num_levels to be at least "
+          "CompactionOptionsHybrid::num_leveled_levels + 2.");
+    }
+  }
   return s;
 }
 
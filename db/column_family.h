@@ -10,6 +10,8 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -221,6 +223,11 @@ struct SuperVersion {
   // immutable once SuperVersion is installed. For column family that doesn't
   // enable UDT feature, this is an empty string.
   std::string full_history_ts_low;
+  // Counts the writes that added data to the column family without going
+  // through the memtable write path (file ingestion and WriteBatchWithIndex
+  // ingestion) up to this SuperVersion. Used to invalidate
+  // DBOptions::negative_lookup_cache entries.
+  uint64_t external_write_generation = 0;
 
   // An immutable snapshot of the DB's seqno to time mapping, usually shared
   // between SuperVersions.
@@ -257,6 +264,14 @@ struct SuperVersion {
     return seqno_to_time_mapping.get();
   }
 
+  // For MutableCFOptions::range_tombstone_index_for_point_lookups. Returns the
+  // range tombstones of imm and current merged into one fragmented list,
+  // which the first call builds. Each SST file's tombstones are limited to the
+  // user keys within the file's boundaries, where a point lookup would apply
+  // them. Returns nullptr if the list could not be built. Requires the
+  // bytewise comparator. Thread-safe.
+  FragmentedRangeTombstoneList* GetRangeTombstoneIndex();
+
   // The value of dummy is not actually used. kSVInUse takes its address as a
   // mark in the thread local storage to indicate the SuperVersion is in use
   // by thread. This way, the value of kSVInUse is guaranteed to have no
@@ -272,6 +287,8 @@ struct SuperVersion {
   // all memtables that we need to free through this vector. We then
   // delete all those memtables outside of mutex, during destruction
   autovector<ReadOnlyMemTable*> to_delete;
+  std::once_flag range_tombstone_index_once_;
+  std::unique_ptr<FragmentedRangeTombstoneList> range_tombstone_index_;
 };
 
 Status CheckCompressionSupported(const ColumnFamilyOptions& cf_options);
@@ -549,6 +566,13 @@ class ColumnFamilyData {
     }
   }
 
+  // Called with the DB mutex held before installing a SuperVersion that
+  // includes data not written through the memtable write path.
+  void BumpExternalWriteGeneration() { external_write_generation_++; }
+  uint64_t GetExternalWriteGeneration() const {
+    return external_write_generation_;
+  }
+
   const std::string& GetFullHistoryTsLow() const {
     const Comparator* ucmp = user_comparator();
     assert(ucmp);
@@ -701,6 +725,8 @@ class ColumnFamilyData {
 
   std::string full_history_ts_low_;
 
+  uint64_t external_write_generation_ = 0;
+
   // For charging memory usage of file metadata created for newly added files to
   // a Version associated with this CFD
   std::shared_ptr<CacheReservationManager> file_metadata_cache_res_mgr_;
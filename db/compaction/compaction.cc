@@ -338,6 +338,12 @@ Compaction::Compaction(
                   _blob_garbage_collection_age_cutoff > 1
               ? mutable_cf_options().blob_garbage_collection_age_cutoff
               : _blob_garbage_collection_age_cutoff),
+      blob_files_marked_for_gc_(
+          enable_blob_garbage_collection_ &&
+                  mutable_cf_options().blob_garbage_collection_file_threshold <
+                      1.0
+              ? vstorage->BlobFilesMarkedForGarbageCollection()
+              : std::vector<uint64_t>()),
       proximal_level_(
           // For simplicity, we don't support the concept of "proximal level"
           // with `CompactionReason::kExternalSstIngestion` and
@@ -932,7 +938,8 @@ bool Compaction::ShouldFormSubcompactions() const {
 
   if (cfd_->ioptions().compaction_style == kCompactionStyleLevel) {
     return (start_level_ == 0 || is_manual_compaction_) && output_level_ > 0;
-  } else if (cfd_->ioptions().compaction_style == kCompactionStyleUniversal) {
+  } else if (cfd_->ioptions().compaction_style == kCompactionStyleUniversal ||
+             cfd_->ioptions().compaction_style == kCompactionStyleHybrid) {
     return number_levels_ > 1 && output_level_ > 0;
   } else {
     return false;
@@ -1075,14 +1082,21 @@ void Compaction::FilterInputsForCompactionIterator() {
   size_t num_input_levels = inputs_.size();
   // TODO(yuzhangyu): filtering of older L0 file by new L0 file is not
   // supported yet.
-  FileMetaData* rangedel_candidate = inputs_[0].level == 0
-                                         ? inputs_[0].files.back()
-                                         : inputs_[0].files.front();
-  assert(rangedel_candidate);
-  if (!rangedel_candidate->FileIsStandAloneRangeTombstone() ||
-      !DataIsDefinitelyInSnapshot(rangedel_candidate->fd.smallest_seqno,
-                                  earliest_snapshot_.value(),
-                                  snapshot_checker_)) {
+  // The start level inputs may contain more than one file, e.g. when a
+  // leveled compaction expands a marked standalone range deletion file to a
+  // clean cut. Any of them that is a standalone range deletion visible to all
+  // snapshots can shadow non-start level input files.
+  std::vector<const FileMetaData*> rangedel_candidates;
+  for (const FileMetaData* file : inputs_[0].files) {
+    assert(file);
+    if (file->FileIsStandAloneRangeTombstone() &&
+        DataIsDefinitelyInSnapshot(file->fd.smallest_seqno,
+                                   earliest_snapshot_.value(),
+                                   snapshot_checker_)) {
+      rangedel_candidates.push_back(file);
+    }
+  }
+  if (rangedel_candidates.empty()) {
     for (size_t level = 0; level < num_input_levels; level++) {
       DoGenerateLevelFilesBrief(&input_levels_[level], inputs_[level].files,
                                 &arena_);
@@ -1090,9 +1104,21 @@ void Compaction::FilterInputsForCompactionIterator() {
     return;
   }
 
-  Slice rangedel_start_ukey = rangedel_candidate->smallest.user_key();
-  Slice rangedel_end_ukey = rangedel_candidate->largest.user_key();
-  SequenceNumber rangedel_seqno = rangedel_candidate->fd.smallest_seqno;
+  // When range data and point data has the same sequence number, point
+  // data wins. Range deletion end key is exclusive, so check it's bigger
+  // than file right boundary user key.
+  auto is_shadowed = [&](const FileMetaData* file) {
+    for (const FileMetaData* rangedel : rangedel_candidates) {
+      if (rangedel->fd.smallest_seqno > file->fd.largest_seqno &&
+          ucmp->CompareWithoutTimestamp(rangedel->smallest.user_key(),
+                                        file->smallest.user_key()) <= 0 &&
+          ucmp->CompareWithoutTimestamp(rangedel->largest.user_key(),
+                                        file->largest.user_key()) > 0) {
+        return true;
+      }
+    }
+    return false;
+  };
 
   std::vector<std::vector<FileMetaData*>> non_start_level_input_files;
   non_start_level_input_files.reserve(num_input_levels - 1);
@@ -1102,14 +1128,7 @@ void Compaction::FilterInputsForCompactionIterator() {
     non_start_level_input_files_filtered_.emplace_back();
     for (FileMetaData* file : inputs_[level].files) {
       non_start_level_input_files_filtered_.back().push_back(false);
-      // When range data and point data has the same sequence number, point
-      // data wins. Range deletion end key is exclusive, so check it's bigger
-      // than file right boundary user key.
-      if (rangedel_seqno > file->fd.largest_seqno &&
-          ucmp->CompareWithoutTimestamp(rangedel_start_ukey,
-                                        file->smallest.user_key()) <= 0 &&
-          ucmp->CompareWithoutTimestamp(rangedel_end_ukey,
-                                        file->largest.user_key()) > 0) {
+      if (is_shadowed(file)) {
         non_start_level_input_files_filtered_.back().back() = true;
         filtered_input_levels_[level].push_back(file);
       } else {
@@ -422,6 +422,14 @@ class Compaction {
     return blob_garbage_collection_age_cutoff_;
   }
 
+  // Blob files (sorted by file number) whose live blobs should be relocated
+  // regardless of blob_garbage_collection_age_cutoff because their garbage
+  // ratio reached blob_garbage_collection_file_threshold when the compaction
+  // was picked.
+  const std::vector<uint64_t>& blob_files_marked_for_gc() const {
+    return blob_files_marked_for_gc_;
+  }
+
   // start and end are sub compact range. Null if no boundary.
   // This is used to calculate the newest_key_time table property after
   // compaction.
@@ -561,7 +569,9 @@ class Compaction {
 
   // The earliest snapshot and snapshot checker at compaction picking time.
   // These fields are only set for deletion triggered compactions picked in
-  // universal compaction. And when user-defined timestamp is not enabled.
+  // universal compaction, and for leveled compactions that start from a marked
+  // standalone range deletion file. And when user-defined timestamp is not
+  // enabled.
   // It will be used to possibly filter out some non start level input files.
   std::optional<SequenceNumber> earliest_snapshot_;
   const SnapshotChecker* snapshot_checker_;
@@ -619,6 +629,9 @@ class Compaction {
   // Blob garbage collection age cutoff.
   double blob_garbage_collection_age_cutoff_;
 
+  // Blob files selected for garbage collection by their garbage ratio.
+  std::vector<uint64_t> blob_files_marked_for_gc_;
+
   SequenceNumber keep_in_last_level_through_seqno_ = kMaxSequenceNumber;
 
   // only set when per_key_placement feature is enabled, -1 (kInvalidLevel)
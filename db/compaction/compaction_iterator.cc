@@ -5,6 +5,7 @@
 
 #include "db/compaction/compaction_iterator.h"
 
+#include <algorithm>
 #include <iterator>
 #include <limits>
 
@@ -1181,7 +1182,8 @@ void CompactionIterator::GarbageCollectBlobIfNeeded() {
     }
 
     if (blob_index.file_number() >=
-        blob_garbage_collection_cutoff_file_number_) {
+            blob_garbage_collection_cutoff_file_number_ &&
+        !IsBlobFileMarkedForGarbageCollection(blob_index.file_number())) {
       return;
     }
 
@@ -1368,6 +1370,14 @@ inline SequenceNumber CompactionIterator::findEarliestVisibleSnapshot(
   return kMaxSequenceNumber;
 }
 
+bool CompactionIterator::IsBlobFileMarkedForGarbageCollection(
+    uint64_t blob_file_number) const {
+  assert(compaction_);
+
+  const auto& marked = compaction_->blob_files_marked_for_gc();
+  return std::binary_search(marked.begin(), marked.end(), blob_file_number);
+}
+
 uint64_t CompactionIterator::ComputeBlobGarbageCollectionCutoffFileNumber(
     const CompactionProxy* compaction) {
   if (!compaction) {
@@ -108,6 +108,8 @@ class CompactionIterator {
 
     virtual double blob_garbage_collection_age_cutoff() const = 0;
 
+    virtual const std::vector<uint64_t>& blob_files_marked_for_gc() const = 0;
+
     virtual uint64_t blob_compaction_readahead_size() const = 0;
 
     virtual const Version* input_version() const = 0;
@@ -160,6 +162,10 @@ class CompactionIterator {
       return compaction_->blob_garbage_collection_age_cutoff();
     }
 
+    const std::vector<uint64_t>& blob_files_marked_for_gc() const override {
+      return compaction_->blob_files_marked_for_gc();
+    }
+
     uint64_t blob_compaction_readahead_size() const override {
       return compaction_->mutable_cf_options().blob_compaction_readahead_size;
     }
@@ -326,6 +332,7 @@ class CompactionIterator {
 
   static uint64_t ComputeBlobGarbageCollectionCutoffFileNumber(
       const CompactionProxy* compaction);
+  bool IsBlobFileMarkedForGarbageCollection(uint64_t blob_file_number) const;
   static std::unique_ptr<BlobFetcher> CreateBlobFetcherIfNeeded(
       const CompactionProxy* compaction);
   static std::unique_ptr<PrefetchBufferCollection>
@@ -180,6 +180,10 @@ class FakeCompaction : public CompactionIterator::CompactionProxy {
 
   double blob_garbage_collection_age_cutoff() const override { return 0.0; }
 
+  const std::vector<uint64_t>& blob_files_marked_for_gc() const override {
+    return blob_files_marked_for_gc_;
+  }
+
   uint64_t blob_compaction_readahead_size() const override { return 0; }
 
   const Version* input_version() const override { return nullptr; }
@@ -199,6 +203,8 @@ class FakeCompaction : public CompactionIterator::CompactionProxy {
   bool is_allow_ingest_behind = false;
 
   bool supports_per_key_placement = false;
+
+  std::vector<uint64_t> blob_files_marked_for_gc_;
 };
 
 // A simplified snapshot checker which assumes each snapshot has a global
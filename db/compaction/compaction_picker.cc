@@ -612,10 +612,11 @@ Compaction* CompactionPicker::CompactRange(
   assert(ioptions_.compaction_style != kCompactionStyleFIFO);
 
   if (input_level == ColumnFamilyData::kCompactAllLevels) {
-    assert(ioptions_.compaction_style == kCompactionStyleUniversal);
+    assert(ioptions_.compaction_style == kCompactionStyleUniversal ||
+           ioptions_.compaction_style == kCompactionStyleHybrid);
 
-    // Universal compaction with more than one level always compacts all the
-    // files together to the last level.
+    // Universal and hybrid compaction with more than one level always compact
+    // all the files together to the last level.
     assert(vstorage->num_levels() > 1);
     int max_output_level =
         vstorage->MaxOutputLevel(ioptions_.allow_ingest_behind);
@@ -696,9 +697,10 @@ Compaction* CompactionPicker::CompactRange(
   inputs.level = input_level;
   bool covering_the_whole_range = true;
 
-  // All files are 'overlapping' in universal style compaction.
+  // All files are 'overlapping' in universal and hybrid style compaction.
   // We have to compact the entire range in one shot.
-  if (ioptions_.compaction_style == kCompactionStyleUniversal) {
+  if (ioptions_.compaction_style == kCompactionStyleUniversal ||
+      ioptions_.compaction_style == kCompactionStyleHybrid) {
     begin = nullptr;
     end = nullptr;
   }
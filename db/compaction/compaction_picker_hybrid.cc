@@ -0,0 +1,402 @@
+//  Copyright (c) 2011-present, Facebook, Inc.  All rights reserved.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+//
+// Copyright (c) 2011 The LevelDB Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file. See the AUTHORS file for names of contributors.
+
+#include "db/compaction/compaction_picker_hybrid.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "db/column_family.h"
+#include "logging/log_buffer.h"
+#include "logging/logging.h"
+#include "monitoring/statistics_impl.h"
+#include "test_util/sync_point.h"
+
+namespace ROCKSDB_NAMESPACE {
+namespace {
+// A helper class that forms hybrid compactions. The class is used by
+// HybridCompactionPicker::PickCompaction().
+// The usage is to create the class, and get the compaction object by calling
+// PickCompaction().
+class HybridCompactionBuilder {
+ public:
+  HybridCompactionBuilder(const ImmutableOptions& ioptions,
+                          const std::string& cf_name,
+                          const MutableCFOptions& mutable_cf_options,
+                          const MutableDBOptions& mutable_db_options,
+                          VersionStorageInfo* vstorage,
+                          HybridCompactionPicker* picker, LogBuffer* log_buffer)
+      : ioptions_(ioptions),
+        cf_name_(cf_name),
+        mutable_cf_options_(mutable_cf_options),
+        mutable_db_options_(mutable_db_options),
+        hybrid_options_(mutable_cf_options.compaction_options_hybrid),
+        vstorage_(vstorage),
+        picker_(picker),
+        log_buffer_(log_buffer) {
+    last_level_ = vstorage_->MaxOutputLevel(ioptions_.allow_ingest_behind);
+    first_leveled_level_ = last_level_ - hybrid_options_.num_leveled_levels + 1;
+    // Guaranteed by ColumnFamilyData::ValidateOptions().
+    assert(first_leveled_level_ >= 2);
+  }
+
+  // Form and return the compaction object. The caller owns return object.
+  Compaction* PickCompaction();
+
+ private:
+  struct SortedRun {
+    int level;
+    // `file` will be null for level > 0. For level = 0, the sorted run is
+    // for this file.
+    FileMetaData* file;
+    uint64_t size;
+    bool being_compacted;
+  };
+
+  // Collects the tiered sorted runs, from the newest to the oldest.
+  void CalculateSortedRuns();
+
+  // Returns the tier that a sorted run of `size` bytes belongs to.
+  int TierOf(uint64_t size) const;
+
+  // Returns the number of sorted runs that `tier` can hold before they are
+  // merged together.
+  size_t MaxRunsForTier(int tier) const;
+
+  uint64_t LevelSize(int level) const;
+
+  // Moves files from the second last level into the last level when there
+  // are two leveled levels and the second last one is too large.
+  Compaction* PickLeveledCompaction();
+
+  // Merges adjacent tiered runs of the same tier when the tier is full.
+  Compaction* PickTieredCompaction();
+
+  // Merges the oldest tiered run into the first leveled level.
+  Compaction* PickLazyLevelingCompaction();
+
+  // Appends the files of sorted_runs_[first..last] to `inputs`, one entry
+  // per level.
+  void AddSortedRunInputs(size_t first, size_t last,
+                          std::vector<CompactionInputFiles>* inputs) const;
+
+  Compaction* MakeCompaction(std::vector<CompactionInputFiles> inputs,
+                             int output_level,
+                             CompactionReason compaction_reason) const;
+
+  const ImmutableOptions& ioptions_;
+  const std::string& cf_name_;
+  const MutableCFOptions& mutable_cf_options_;
+  const MutableDBOptions& mutable_db_options_;
+  const CompactionOptionsHybrid& hybrid_options_;
+  VersionStorageInfo* vstorage_;
+  HybridCompactionPicker* picker_;
+  LogBuffer* log_buffer_;
+  int last_level_;
+  int first_leveled_level_;
+  std::vector<SortedRun> sorted_runs_;
+};
+
+void HybridCompactionBuilder::CalculateSortedRuns() {
+  for (FileMetaData* f : vstorage_->LevelFiles(0)) {
+    sorted_runs_.push_back({0, f, f->fd.GetFileSize(), f->being_compacted});
+  }
+  for (int level = 1; level < first_leveled_level_; level++) {
+    const std::vector<FileMetaData*>& files = vstorage_->LevelFiles(level);
+    if (files.empty()) {
+      continue;
+    }
+    uint64_t total_size = 0;
+    bool being_compacted = false;
+    for (FileMetaData* f : files) {
+      total_size += f->fd.GetFileSize();
+      being_compacted |= f->being_compacted;
+    }
+    sorted_runs_.push_back({level, nullptr, total_size, being_compacted});
+  }
+}
+
+int HybridCompactionBuilder::TierOf(uint64_t size) const {
+  const double ratio = static_cast<double>(hybrid_options_.size_ratio);
+  const size_t base_size =
+      std::max<size_t>(mutable_cf_options_.write_buffer_size, 1);
+  double upper_bound = static_cast<double>(base_size) * ratio;
+  int tier = 0;
+  while (static_cast<double>(size) >= upper_bound) {
+    upper_bound *= ratio;
+    tier++;
+  }
+  return tier;
+}
+
+size_t HybridCompactionBuilder::MaxRunsForTier(int tier) const {
+  const std::vector<int>& max_runs = hybrid_options_.max_runs_per_tier;
+  int result = hybrid_options_.size_ratio;
+  if (static_cast<size_t>(tier) < max_runs.size() && max_runs[tier] > 0) {
+    result = max_runs[tier];
+  }
+  // Merging a single run would not reduce the number of sorted runs.
+  return static_cast<size_t>(std::max(result, 2));
+}
+
+uint64_t HybridCompactionBuilder::LevelSize(int level) const {
+  uint64_t total_size = 0;
+  for (FileMetaData* f : vstorage_->LevelFiles(level)) {
+    total_size += f->fd.GetFileSize();
+  }
+  return total_size;
+}
+
+Compaction* HybridCompactionBuilder::PickCompaction() {
+  CalculateSortedRuns();
+
+  Compaction* c = nullptr;
+  if (hybrid_options_.num_leveled_levels == 2) {
+    c = PickLeveledCompaction();
+  }
+  if (c == nullptr) {
+    c = PickTieredCompaction();
+  }
+  if (c == nullptr) {
+    c = PickLazyLevelingCompaction();
+  }
+  if (c == nullptr) {
+    TEST_SYNC_POINT_CALLBACK("HybridCompactionBuilder::PickCompaction:Return",
+                             nullptr);
+    return nullptr;
+  }
+
+  size_t num_files = 0;
+  for (auto& each_level : *c->inputs()) {
+    num_files += each_level.files.size();
+  }
+  RecordInHistogram(ioptions_.stats, NUM_FILES_IN_SINGLE_COMPACTION, num_files);
+
+  picker_->RegisterCompaction(c);
+  vstorage_->ComputeCompactionScore(ioptions_, mutable_cf_options_);
+
+  TEST_SYNC_POINT_CALLBACK("HybridCompactionBuilder::PickCompaction:Return",
+                           c);
+  return c;
+}
+
+Compaction* HybridCompactionBuilder::PickLeveledCompaction() {
+  const int start_level = last_level_ - 1;
+  const uint64_t start_level_size = LevelSize(start_level);
+  const uint64_t last_level_size = LevelSize(last_level_);
+  if (start_level_size == 0 ||
+      static_cast<double>(start_level_size) * hybrid_options_.size_ratio <
+          static_cast<double>(last_level_size)) {
+    return nullptr;
+  }
+
+  // Prefer the files with the smallest overlapping ratio in the last level,
+  // like kMinOverlappingRatio does for leveled compaction.
+  std::vector<std::pair<uint64_t, FileMetaData*>> candidates;
+  for (FileMetaData* f : vstorage_->LevelFiles(start_level)) {
+    if (f->being_compacted) {
+      continue;
+    }
+    std::vector<FileMetaData*> overlapping;
+    vstorage_->GetOverlappingInputs(last_level_, &f->smallest, &f->largest,
+                                    &overlapping);
+    uint64_t overlapping_bytes = 0;
+    for (FileMetaData* o : overlapping) {
+      overlapping_bytes += o->fd.GetFileSize();
+    }
+    candidates.emplace_back(
+        overlapping_bytes * 1024U / std::max<uint64_t>(f->fd.GetFileSize(), 1),
+        f);
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const std::pair<uint64_t, FileMetaData*>& a,
+               const std::pair<uint64_t, FileMetaData*>& b) {
+              return a.first < b.first;
+            });
+
+  for (const auto& candidate : candidates) {
+    CompactionInputFiles start_level_inputs;
+    start_level_inputs.level = start_level;
+    start_level_inputs.files.push_back(candidate.second);
+    if (!picker_->ExpandInputsToCleanCut(cf_name_, vstorage_,
+                                         &start_level_inputs) ||
+        picker_->AreFilesInCompaction(start_level_inputs.files)) {
+      continue;
+    }
+
+    InternalKey smallest, largest;
+    picker_->GetRange(start_level_inputs, &smallest, &largest);
+    CompactionInputFiles output_level_inputs;
+    output_level_inputs.level = last_level_;
+    vstorage_->GetOverlappingInputs(last_level_, &smallest, &largest,
+                                    &output_level_inputs.files);
+    if (picker_->AreFilesInCompaction(output_level_inputs.files)) {
+      continue;
+    }
+
+    std::vector<CompactionInputFiles> inputs;
+    inputs.push_back(std::move(start_level_inputs));
+    if (!output_level_inputs.empty()) {
+      inputs.push_back(std::move(output_level_inputs));
+    }
+    if (picker_->FilesRangeOverlapWithCompaction(inputs, last_level_,
+                                                 Compaction::kInvalidLevel)) {
+      continue;
+    }
+    ROCKS_LOG_BUFFER(log_buffer_,
+                     "[%s] Hybrid: compacting L%d (%" PRIu64
+                     " bytes) into L%d (%" PRIu64 " bytes)",
+                     cf_name_.c_str(), start_level, start_level_size,
+                     last_level_, last_level_size);
+    return MakeCompaction(std::move(inputs), last_level_,
+                          CompactionReason::kLevelMaxLevelSize);
+  }
+  return nullptr;
+}
+
+Compaction* HybridCompactionBuilder::PickTieredCompaction() {
+  size_t first = 0;
+  while (first < sorted_runs_.size()) {
+    const int tier = TierOf(sorted_runs_[first].size);
+    bool being_compacted = sorted_runs_[first].being_compacted;
+    size_t last = first;
+    while (last + 1 < sorted_runs_.size() &&
+           TierOf(sorted_runs_[last + 1].size) == tier) {
+      last++;
+      being_compacted |= sorted_runs_[last].being_compacted;
+    }
+
+    if (!being_compacted && last - first + 1 >= MaxRunsForTier(tier)) {
+      // Place the merged run right above the next older sorted run, or in the
+      // last tiered level when there is none.
+      int output_level = first_leveled_level_ - 1;
+      if (last + 1 < sorted_runs_.size()) {
+        const int next_level = sorted_runs_[last + 1].level;
+        output_level = next_level == 0 ? 0 : next_level - 1;
+      }
+      assert(output_level >= sorted_runs_[last].level);
+
+      std::vector<CompactionInputFiles> inputs;
+      AddSortedRunInputs(first, last, &inputs);
+      if (output_level == 0 ||
+          !picker_->FilesRangeOverlapWithCompaction(
+              inputs, output_level, Compaction::kInvalidLevel)) {
+        ROCKS_LOG_BUFFER(log_buffer_,
+                         "[%s] Hybrid: merging %" ROCKSDB_PRIszt
+                         " sorted runs of tier %d into L%d",
+                         cf_name_.c_str(), last - first + 1, tier,
+                         output_level);
+        return MakeCompaction(std::move(inputs), output_level,
+                              CompactionReason::kUniversalSortedRunNum);
+      }
+    }
+    first = last + 1;
+  }
+  return nullptr;
+}
+
+Compaction* HybridCompactionBuilder::PickLazyLevelingCompaction() {
+  if (sorted_runs_.empty()) {
+    return nullptr;
+  }
+  const SortedRun& oldest = sorted_runs_.back();
+  const uint64_t leveled_size = LevelSize(first_leveled_level_);
+  if (oldest.being_compacted ||
+      static_cast<double>(oldest.size) * hybrid_options_.size_ratio <
+          static_cast<double>(leveled_size)) {
+    return nullptr;
+  }
+
+  std::vector<CompactionInputFiles> inputs;
+  AddSortedRunInputs(sorted_runs_.size() - 1, sorted_runs_.size() - 1,
+                     &inputs);
+  InternalKey smallest, largest;
+  picker_->GetRange(inputs.front(), &smallest, &largest);
+  CompactionInputFiles output_level_inputs;
+  output_level_inputs.level = first_leveled_level_;
+  vstorage_->GetOverlappingInputs(first_leveled_level_, &smallest, &largest,
+                                  &output_level_inputs.files);
+  if (picker_->AreFilesInCompaction(output_level_inputs.files)) {
+    return nullptr;
+  }
+  if (!output_level_inputs.empty()) {
+    inputs.push_back(std::move(output_level_inputs));
+  }
+  if (picker_->FilesRangeOverlapWithCompaction(inputs, first_leveled_level_,
+                                               Compaction::kInvalidLevel)) {
+    return nullptr;
+  }
+  ROCKS_LOG_BUFFER(log_buffer_,
+                   "[%s] Hybrid: merging sorted run at L%d (%" PRIu64
+                   " bytes) into L%d (%" PRIu64 " bytes)",
+                   cf_name_.c_str(), oldest.level, oldest.size,
+                   first_leveled_level_, leveled_size);
+  return MakeCompaction(std::move(inputs), first_leveled_level_,
+                        CompactionReason::kUniversalSizeRatio);
+}
+
+void HybridCompactionBuilder::AddSortedRunInputs(
+    size_t first, size_t last,
+    std::vector<CompactionInputFiles>* inputs) const {
+  for (size_t i = first; i <= last; i++) {
+    const SortedRun& sr = sorted_runs_[i];
+    if (inputs->empty() || inputs->back().level != sr.level) {
+      inputs->emplace_back();
+      inputs->back().level = sr.level;
+    }
+    if (sr.level == 0) {
+      inputs->back().files.push_back(sr.file);
+    } else {
+      inputs->back().files = vstorage_->LevelFiles(sr.level);
+    }
+  }
+}
+
+Compaction* HybridCompactionBuilder::MakeCompaction(
+    std::vector<CompactionInputFiles> inputs, int output_level,
+    CompactionReason compaction_reason) const {
+  return new Compaction(
+      vstorage_, ioptions_, mutable_cf_options_, mutable_db_options_,
+      std::move(inputs), output_level,
+      MaxFileSizeForLevel(mutable_cf_options_, output_level,
+                          kCompactionStyleHybrid),
+      mutable_cf_options_.max_compaction_bytes, /* output_path_id */ 0,
+      GetCompressionType(vstorage_, mutable_cf_options_, output_level, 1),
+      GetCompressionOptions(mutable_cf_options_, vstorage_, output_level),
+      mutable_cf_options_.default_write_temperature,
+      /* max_subcompactions */ 0, /* grandparents */ {},
+      /* earliest_snapshot */ std::nullopt,
+      /* snapshot_checker */ nullptr,
+      /* is manual */ false, /* trim_ts */ "", vstorage_->CompactionScore(0),
+      /* deletion_compaction */ false, /* l0_files_might_overlap */ true,
+      compaction_reason);
+}
+}  // anonymous namespace
+
+bool HybridCompactionPicker::NeedsCompaction(
+    const VersionStorageInfo* vstorage) const {
+  const int kLevel0 = 0;
+  return vstorage->CompactionScore(kLevel0) >= 1;
+}
+
+Compaction* HybridCompactionPicker::PickCompaction(
+    const std::string& cf_name, const MutableCFOptions& mutable_cf_options,
+    const MutableDBOptions& mutable_db_options,
+    const std::vector<SequenceNumber>& /* existing_snapshots */,
+    const SnapshotChecker* /* snapshot_checker */,
+    VersionStorageInfo* vstorage, LogBuffer* log_buffer) {
+  HybridCompactionBuilder builder(ioptions_, cf_name, mutable_cf_options,
+                                  mutable_db_options, vstorage, this,
+                                  log_buffer);
+  return builder.PickCompaction();
+}
+}  // namespace ROCKSDB_NAMESPACE
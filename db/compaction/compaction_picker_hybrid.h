@@ -0,0 +1,44 @@
+//  Copyright (c) 2011-present, Facebook, Inc.  All rights reserved.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+//
+// Copyright (c) 2011 The LevelDB Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file. See the AUTHORS file for names of contributors.
+
+#pragma once
+
+#include "db/compaction/compaction_picker.h"
+
+namespace ROCKSDB_NAMESPACE {
+// Picks compactions for kCompactionStyleHybrid. The LSM-tree has the same
+// layout as universal compaction (each L0 file and each non-empty level is a
+// sorted run), but only the levels above the last
+// `CompactionOptionsHybrid::num_leveled_levels` levels are tiered. In order of
+// priority, the picker:
+// 1. Moves files from the second last level into the last level when there
+//    are two leveled levels and the second last one has grown beyond
+//    1/size_ratio of the last one.
+// 2. Merges adjacent tiered runs of the same tier once the tier holds
+//    `max_runs_per_tier` runs.
+// 3. Merges the oldest tiered run into the overlapping files of the first
+//    leveled level once it is at least 1/size_ratio of that level's size.
+class HybridCompactionPicker : public CompactionPicker {
+ public:
+  HybridCompactionPicker(const ImmutableOptions& ioptions,
+                         const InternalKeyComparator* icmp)
+      : CompactionPicker(ioptions, icmp) {}
+
+  Compaction* PickCompaction(
+      const std::string& cf_name, const MutableCFOptions& mutable_cf_options,
+      const MutableDBOptions& mutable_db_options,
+      const std::vector<SequenceNumber>& /* existing_snapshots */,
+      const SnapshotChecker* /* snapshot_checker */,
+      VersionStorageInfo* vstorage, LogBuffer* log_buffer) override;
+
+  int MaxOutputLevel() const override { return NumberLevels() - 1; }
+
+  bool NeedsCompaction(const VersionStorageInfo* vstorage) const override;
+};
+}  // namespace ROCKSDB_NAMESPACE
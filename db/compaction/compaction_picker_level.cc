@@ -13,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "db/snapshot_checker.h"
 #include "db/version_edit.h"
 #include "logging/log_buffer.h"
 #include "test_util/sync_point.h"
@@ -61,14 +62,27 @@ class LevelCompactionBuilder {
                          LogBuffer* log_buffer,
                          const MutableCFOptions& mutable_cf_options,
                          const ImmutableOptions& ioptions,
-                         const MutableDBOptions& mutable_db_options)
+                         const MutableDBOptions& mutable_db_options,
+                         const std::vector<SequenceNumber>& existing_snapshots,
+                         const SnapshotChecker* snapshot_checker)
       : cf_name_(cf_name),
         vstorage_(vstorage),
         compaction_picker_(compaction_picker),
         log_buffer_(log_buffer),
         mutable_cf_options_(mutable_cf_options),
         ioptions_(ioptions),
-        mutable_db_options_(mutable_db_options) {}
+        mutable_db_options_(mutable_db_options) {
+    const auto* ucmp = vstorage_->user_comparator();
+    assert(ucmp);
+    // These parameters are only used when user-defined timestamp is not
+    // enabled.
+    if (ucmp->timestamp_size() == 0) {
+      earliest_snapshot_ = existing_snapshots.empty()
+                               ? kMaxSequenceNumber
+                               : existing_snapshots.at(0);
+      snapshot_checker_ = snapshot_checker;
+    }
+  }
 
   // Pick and return a compaction.
   Compaction* PickCompaction();
@@ -136,6 +150,11 @@ class LevelCompactionBuilder {
       const autovector<std::pair<int, FileMetaData*>>& level_files,
       CompactToNextLevel compact_to_next_level);
 
+  // Whether a marked standalone range deletion file should be left alone for
+  // now: until it is visible to all snapshots, compacting it cannot drop the
+  // lower level files it shadows without reading them.
+  bool ShouldSkipMarkedFile(const FileMetaData* file) const;
+
   const std::string& cf_name_;
   VersionStorageInfo* vstorage_;
   CompactionPicker* compaction_picker_;
@@ -156,6 +175,10 @@ class LevelCompactionBuilder {
   const MutableCFOptions& mutable_cf_options_;
   const ImmutableOptions& ioptions_;
   const MutableDBOptions& mutable_db_options_;
+  // The earliest snapshot and snapshot checker at compaction picking time,
+  // used to drop lower level inputs shadowed by a standalone range deletion.
+  std::optional<SequenceNumber> earliest_snapshot_;
+  const SnapshotChecker* snapshot_checker_ = nullptr;
   // Pick a path ID to place a newly generated file, with its level
   static uint32_t GetPathId(const ImmutableCFOptions& ioptions,
                             const MutableCFOptions& mutable_cf_options,
@@ -199,6 +222,20 @@ void LevelCompactionBuilder::PickFileToCompact(
   start_level_inputs_.files.clear();
 }
 
+bool LevelCompactionBuilder::ShouldSkipMarkedFile(
+    const FileMetaData* file) const {
+  assert(file->marked_for_compaction);
+  if (!earliest_snapshot_.has_value() ||
+      !file->FileIsStandAloneRangeTombstone()) {
+    return false;
+  }
+  // `DB::ReleaseSnapshot` will re-examine and schedule compaction for it once
+  // the earliest snapshot advances at or above this file.
+  return !DataIsDefinitelyInSnapshot(file->fd.largest_seqno,
+                                     earliest_snapshot_.value(),
+                                     snapshot_checker_);
+}
+
 void LevelCompactionBuilder::SetupInitialFiles() {
   // Find the compactions by size on all levels.
   bool skipped_l0_to_base = false;
@@ -263,8 +300,8 @@ void LevelCompactionBuilder::SetupInitialFiles() {
 
   compaction_picker_->PickFilesMarkedForCompaction(
       cf_name_, vstorage_, &start_level_, &output_level_, &start_level_inputs_,
-      /*skip_marked_file*/ [](const FileMetaData* /* file */) {
-        return false;
+      /*skip_marked_file*/ [this](const FileMetaData* file) {
+        return ShouldSkipMarkedFile(file);
       });
   if (!start_level_inputs_.empty()) {
     compaction_reason_ = CompactionReason::kFilesMarkedForCompaction;
@@ -560,8 +597,10 @@ Compaction* LevelCompactionBuilder::GetCompaction() {
       GetCompressionOptions(mutable_cf_options_, vstorage_, output_level_),
       mutable_cf_options_.default_write_temperature,
       /* max_subcompactions */ 0, std::move(grandparents_),
-      /* earliest_snapshot */ std::nullopt, /* snapshot_checker */ nullptr,
-      is_manual_,
+      compaction_reason_ == CompactionReason::kFilesMarkedForCompaction
+          ? earliest_snapshot_
+          : std::nullopt,
+      snapshot_checker_, is_manual_,
       /* trim_ts */ "", start_level_score_, false /* deletion_compaction */,
       l0_files_might_overlap, compaction_reason_);
 
@@ -976,12 +1015,13 @@ bool LevelCompactionBuilder::PickSizeBasedIntraL0Compaction() {
 Compaction* LevelCompactionPicker::PickCompaction(
     const std::string& cf_name, const MutableCFOptions& mutable_cf_options,
     const MutableDBOptions& mutable_db_options,
-    const std::vector<SequenceNumber>& /*existing_snapshots */,
-    const SnapshotChecker* /*snapshot_checker*/, VersionStorageInfo* vstorage,
+    const std::vector<SequenceNumber>& existing_snapshots,
+    const SnapshotChecker* snapshot_checker, VersionStorageInfo* vstorage,
     LogBuffer* log_buffer) {
   LevelCompactionBuilder builder(cf_name, vstorage, this, log_buffer,
                                  mutable_cf_options, ioptions_,
-                                 mutable_db_options);
+                                 mutable_db_options, existing_snapshots,
+                                 snapshot_checker);
   return builder.PickCompaction();
 }
 }  // namespace ROCKSDB_NAMESPACE
@@ -9,6 +9,7 @@
 
 #include "db/compaction/compaction.h"
 #include "db/compaction/compaction_picker_fifo.h"
+#include "db/compaction/compaction_picker_hybrid.h"
 #include "db/compaction/compaction_picker_level.h"
 #include "db/compaction/compaction_picker_universal.h"
 #include "db/compaction/file_pri.h"
@@ -582,6 +583,101 @@ TEST_F(CompactionPickerTest, CompactionUniversalIngestBehindReservedLevel) {
     }
   }
 }
+
+TEST_F(CompactionPickerTest, HybridMergesFullTier) {
+  const int kNumLevels = 5;
+  ioptions_.compaction_style = kCompactionStyleHybrid;
+  mutable_cf_options_.write_buffer_size = 1000;
+  mutable_cf_options_.compaction_options_hybrid.size_ratio = 4;
+  HybridCompactionPicker hybrid_compaction_picker(ioptions_, &icmp_);
+  NewVersionStorage(kNumLevels, kCompactionStyleHybrid);
+  // Four tier-0 runs fill up the tier, the last level is too large for the
+  // oldest of them to be merged into it.
+  Add(0, 1U, "150", "200", 1000U, 0, 400, 450);
+  Add(0, 2U, "201", "250", 1000U, 0, 300, 350);
+  Add(0, 3U, "260", "300", 1000U, 0, 200, 250);
+  Add(0, 4U, "100", "151", 1000U, 0, 101, 150);
+  Add(4, 5U, "100", "400", 100000U, 0, 10, 100);
+  UpdateVersionStorageInfo();
+
+  ASSERT_TRUE(hybrid_compaction_picker.NeedsCompaction(vstorage_.get()));
+  std::unique_ptr<Compaction> compaction(
+      hybrid_compaction_picker.PickCompaction(
+          cf_name_, mutable_cf_options_, mutable_db_options_,
+          /*existing_snapshots=*/{}, /* snapshot_checker */ nullptr,
+          vstorage_.get(), &log_buffer_));
+  ASSERT_TRUE(compaction.get() != nullptr);
+  ASSERT_EQ(CompactionReason::kUniversalSortedRunNum,
+            compaction->compaction_reason());
+  ASSERT_EQ(1U, compaction->num_input_levels());
+  ASSERT_EQ(4U, compaction->num_input_files(0));
+  // The merged run goes to the last tiered level.
+  ASSERT_EQ(3, compaction->output_level());
+}
+
+TEST_F(CompactionPickerTest, HybridMergesOldestRunIntoLeveledLevel) {
+  const int kNumLevels = 5;
+  ioptions_.compaction_style = kCompactionStyleHybrid;
+  mutable_cf_options_.write_buffer_size = 1000;
+  mutable_cf_options_.compaction_options_hybrid.size_ratio = 4;
+  HybridCompactionPicker hybrid_compaction_picker(ioptions_, &icmp_);
+  NewVersionStorage(kNumLevels, kCompactionStyleHybrid);
+  // Every tier holds a single run. The run in L2 is more than a quarter of
+  // the last level.
+  Add(0, 1U, "150", "200", 1000U, 0, 400, 450);
+  Add(2, 2U, "150", "180", 30000U, 0, 200, 250);
+  Add(4, 3U, "100", "200", 50000U, 0, 10, 100);
+  Add(4, 4U, "300", "400", 50000U, 0, 10, 100);
+  UpdateVersionStorageInfo();
+
+  std::unique_ptr<Compaction> compaction(
+      hybrid_compaction_picker.PickCompaction(
+          cf_name_, mutable_cf_options_, mutable_db_options_,
+          /*existing_snapshots=*/{}, /* snapshot_checker */ nullptr,
+          vstorage_.get(), &log_buffer_));
+  ASSERT_TRUE(compaction.get() != nullptr);
+  ASSERT_EQ(2U, compaction->num_input_levels());
+  ASSERT_EQ(2, compaction->start_level());
+  ASSERT_EQ(2U, compaction->input(0, 0)->fd.GetNumber());
+  // Only the overlapping file of the leveled level is rewritten.
+  ASSERT_EQ(1U, compaction->num_input_files(1));
+  ASSERT_EQ(3U, compaction->input(1, 0)->fd.GetNumber());
+  ASSERT_EQ(4, compaction->output_level());
+}
+
+TEST_F(CompactionPickerTest, HybridTwoLeveledLevels) {
+  const int kNumLevels = 5;
+  ioptions_.compaction_style = kCompactionStyleHybrid;
+  mutable_cf_options_.compaction_options_hybrid.size_ratio = 10;
+  mutable_cf_options_.compaction_options_hybrid.num_leveled_levels = 2;
+  HybridCompactionPicker hybrid_compaction_picker(ioptions_, &icmp_);
+  NewVersionStorage(kNumLevels, kCompactionStyleHybrid);
+  Add(3, 1U, "100", "150", 40000U, 0, 200, 250);
+  Add(3, 2U, "200", "250", 40000U, 0, 200, 250);
+  Add(3, 3U, "300", "350", 40000U, 0, 200, 250);
+  Add(4, 4U, "100", "150", 300000U, 0, 10, 100);
+  Add(4, 5U, "200", "250", 50000U, 0, 10, 100);
+  Add(4, 6U, "300", "350", 400000U, 0, 10, 100);
+  UpdateVersionStorageInfo();
+
+  // Only two sorted runs, but the second last level is more than a tenth of
+  // the last level.
+  ASSERT_TRUE(hybrid_compaction_picker.NeedsCompaction(vstorage_.get()));
+  std::unique_ptr<Compaction> compaction(
+      hybrid_compaction_picker.PickCompaction(
+          cf_name_, mutable_cf_options_, mutable_db_options_,
+          /*existing_snapshots=*/{}, /* snapshot_checker */ nullptr,
+          vstorage_.get(), &log_buffer_));
+  ASSERT_TRUE(compaction.get() != nullptr);
+  ASSERT_EQ(CompactionReason::kLevelMaxLevelSize,
+            compaction->compaction_reason());
+  // The file with the smallest overlapping ratio is picked.
+  ASSERT_EQ(1U, compaction->num_input_files(0));
+  ASSERT_EQ(2U, compaction->input(0, 0)->fd.GetNumber());
+  ASSERT_EQ(1U, compaction->num_input_files(1));
+  ASSERT_EQ(5U, compaction->input(1, 0)->fd.GetNumber());
+  ASSERT_EQ(4, compaction->output_level());
+}
 // Tests if the files can be trivially moved in multi level
 // universal compaction when allow_trivial_move option is set
 // In this test as the input files overlaps, they cannot
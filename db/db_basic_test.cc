@@ -17,6 +17,7 @@
 #include "rocksdb/merge_operator.h"
 #include "rocksdb/perf_context.h"
 #include "rocksdb/table.h"
+#include "rocksdb/threadpool.h"
 #include "rocksdb/utilities/debug.h"
 #include "table/block_based/block_based_table_reader.h"
 #include "table/block_based/block_builder.h"
@@ -1157,6 +1158,163 @@ TEST_F(DBBasicTest, MultiGetSimple) {
   } while (ChangeCompactOptions());
 }
 
+TEST_F(DBBasicTest, MultiGetAsync) {
+  Options options = CurrentOptions();
+  DestroyAndReopen(options);
+  for (int i = 0; i < 100; i++) {
+    ASSERT_OK(Put(Key(i), "v" + std::to_string(i)));
+    if (i == 49) {
+      ASSERT_OK(Flush());
+    }
+  }
+
+  std::unique_ptr<ThreadPool> thread_pool(NewThreadPool(2));
+  const int kNumRequests = 8;
+  const size_t kKeysPerRequest = 12;
+  std::vector<std::string> key_strs;
+  std::vector<Slice> keys;
+  for (int i = 0; i < kNumRequests * static_cast<int>(kKeysPerRequest); i++) {
+    // Every tenth key is missing
+    key_strs.push_back(Key(i % 10 == 9 ? 1000 + i : i));
+  }
+  keys.assign(key_strs.begin(), key_strs.end());
+  std::vector<PinnableSlice> values(keys.size());
+  std::vector<Status> statuses(keys.size());
+  std::atomic<int> num_callbacks{0};
+  std::vector<std::unique_ptr<AsyncReadHandle>> handles;
+  for (int r = 0; r < kNumRequests; r++) {
+    size_t offset = r * kKeysPerRequest;
+    handles.push_back(db_->MultiGetAsync(
+        ReadOptions(), db_->DefaultColumnFamily(), kKeysPerRequest,
+        &keys[offset], &values[offset], &statuses[offset], thread_pool.get(),
+        [&num_callbacks]() { num_callbacks.fetch_add(1); }));
+  }
+  for (auto& handle : handles) {
+    handle->Wait();
+    ASSERT_TRUE(handle->IsReady());
+  }
+  for (size_t i = 0; i < keys.size(); i++) {
+    if (i % 10 == 9) {
+      ASSERT_TRUE(statuses[i].IsNotFound());
+    } else {
+      ASSERT_OK(statuses[i]);
+      ASSERT_EQ(values[i], "v" + std::to_string(i));
+    }
+  }
+  thread_pool->WaitForJobsAndJoinAllThreads();
+  ASSERT_EQ(num_callbacks.load(), kNumRequests);
+
+  // Without a thread pool the read completes before returning
+  PinnableSlice value;
+  Status s;
+  auto handle = db_->GetAsync(ReadOptions(), db_->DefaultColumnFamily(),
+                              Key(7), &value, &s, nullptr);
+  ASSERT_TRUE(handle->IsReady());
+  ASSERT_OK(s);
+  ASSERT_EQ(value, "v7");
+}
+
+namespace {
+// Serves ReadAsync() with a synchronous read and callback, whether or not
+// io_uring is available
+class SyncReadAsyncFileSystem : public FileSystemWrapper {
+ public:
+  explicit SyncReadAsyncFileSystem(const std::shared_ptr<FileSystem>& base)
+      : FileSystemWrapper(base) {}
+
+  static const char* kClassName() { return "SyncReadAsyncFileSystem"; }
+  const char* Name() const override { return kClassName(); }
+
+  IOStatus NewRandomAccessFile(const std::string& fname,
+                               const FileOptions& opts,
+                               std::unique_ptr<FSRandomAccessFile>* result,
+                               IODebugContext* dbg) override {
+    class File : public FSRandomAccessFileOwnerWrapper {
+     public:
+      using FSRandomAccessFileOwnerWrapper::FSRandomAccessFileOwnerWrapper;
+      IOStatus ReadAsync(FSReadRequest& req, const IOOptions& opts,
+                         std::function<void(FSReadRequest&, void*)> cb,
+                         void* cb_arg, void** io_handle,
+                         IOHandleDeleter* del_fn,
+                         IODebugContext* dbg) override {
+        return FSRandomAccessFile::ReadAsync(req, opts, cb, cb_arg, io_handle,
+                                             del_fn, dbg);
+      }
+    };
+    std::unique_ptr<FSRandomAccessFile> file;
+    IOStatus s = target()->NewRandomAccessFile(fname, opts, &file, dbg);
+    if (s.ok()) {
+      result->reset(new File(std::move(file)));
+    }
+    return s;
+  }
+};
+}  // namespace
+
+TEST_F(DBBasicTest, MultiGetSpeculativeReads) {
+  auto fs = std::make_shared<SyncReadAsyncFileSystem>(env_->GetFileSystem());
+  std::unique_ptr<Env> env(new CompositeEnvWrapper(env_, fs));
+  Options options = CurrentOptions();
+  options.env = env.get();
+  options.disable_auto_compactions = true;
+  options.statistics = CreateDBStatistics();
+  BlockBasedTableOptions table_options;
+  table_options.block_cache = NewLRUCache(8 << 20);
+  table_options.filter_policy.reset(NewBloomFilterPolicy(10));
+  table_options.block_size = 256;
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  DestroyAndReopen(options);
+
+  // Every key is in L2, every second one in L1 and every third one in L0
+  for (int level = 2; level >= 0; level--) {
+    for (int i = 0; i < 100; i += 3 - level) {
+      ASSERT_OK(Put(Key(i), "L" + std::to_string(level)));
+    }
+    ASSERT_OK(Flush());
+    if (level > 0) {
+      MoveFilesToLevel(level);
+    }
+  }
+  ASSERT_EQ("1,1,1", FilesPerLevel());
+
+  std::vector<std::string> key_strs;
+  for (int i = 0; i < 100; i += 7) {
+    key_strs.push_back(Key(i));
+  }
+  key_strs.push_back(Key(1000));
+  std::vector<Slice> keys(key_strs.begin(), key_strs.end());
+  auto read_blocks = [&](bool speculative) {
+    table_options.block_cache->EraseUnRefEntries();
+    uint64_t before = TestGetTickerCount(options, BLOCK_CACHE_DATA_ADD);
+    ReadOptions ro;
+    ro.speculative_multiget_reads = speculative;
+    std::vector<PinnableSlice> values(keys.size());
+    std::vector<Status> statuses(keys.size());
+    db_->MultiGet(ro, db_->DefaultColumnFamily(), keys.size(), keys.data(),
+                  values.data(), statuses.data());
+    for (size_t k = 0; k + 1 < keys.size(); k++) {
+      int i = static_cast<int>(k) * 7;
+      EXPECT_OK(statuses[k]);
+      EXPECT_EQ(values[k], i % 3 == 0 ? "L0" : (i % 2 == 0 ? "L1" : "L2"));
+    }
+    EXPECT_TRUE(statuses.back().IsNotFound());
+    return TestGetTickerCount(options, BLOCK_CACHE_DATA_ADD) - before;
+  };
+  uint64_t blocks_read = read_blocks(/*speculative=*/false);
+  // The blocks of the older versions in the lower levels are read too
+  ASSERT_GT(read_blocks(/*speculative=*/true), blocks_read);
+  // Once cached, they are not read again
+  uint64_t before = TestGetTickerCount(options, BLOCK_CACHE_DATA_ADD);
+  ReadOptions ro;
+  ro.speculative_multiget_reads = true;
+  std::vector<PinnableSlice> values(keys.size());
+  std::vector<Status> statuses(keys.size());
+  db_->MultiGet(ro, db_->DefaultColumnFamily(), keys.size(), keys.data(),
+                values.data(), statuses.data());
+  ASSERT_EQ(TestGetTickerCount(options, BLOCK_CACHE_DATA_ADD), before);
+  Close();
+}
+
 TEST_F(DBBasicTest, MultiGetEmpty) {
   do {
     CreateAndReopenWithCF({"pikachu"}, CurrentOptions());
@@ -745,6 +745,122 @@ TEST_F(DBBlockCacheTest, IndexAndFilterBlocksCachePriority) {
   }
 }
 
+TEST_F(DBBlockCacheTest, PrefetchRange) {
+  BlockBasedTableOptions table_options = GetTableOptions();
+  table_options.block_cache = std::make_shared<MockCache>();
+  Options options = GetOptions(table_options);
+  options.compression = kNoCompression;
+  DestroyAndReopen(options);
+  const std::string value(kValueSize, 'a');
+  for (int i = 0; i < 100; i++) {
+    ASSERT_OK(Put(Key(i), value));
+  }
+  ASSERT_OK(Flush());
+
+  // Start from an empty block cache
+  table_options.block_cache = std::make_shared<MockCache>();
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  Reopen(options);
+  ASSERT_OK(options.statistics->Reset());
+  MockCache::high_pri_insert_count = 0;
+  MockCache::low_pri_insert_count = 0;
+
+  ReadOptions read_options;
+  PrefetchRangeOptions prefetch_options;
+  prefetch_options.data_block_priority = Cache::Priority::HIGH;
+  const std::string begin = Key(10);
+  const std::string end = Key(19);
+  const Slice begin_slice(begin);
+  const Slice end_slice(end);
+  read_options.fill_cache = false;
+  ASSERT_TRUE(db_->PrefetchRange(read_options, db_->DefaultColumnFamily(),
+                                 prefetch_options, &begin_slice, &end_slice)
+                  .IsInvalidArgument());
+  read_options.fill_cache = true;
+  ASSERT_OK(db_->PrefetchRange(read_options, db_->DefaultColumnFamily(),
+                               prefetch_options, &begin_slice, &end_slice));
+
+  // One block per key, plus the block at the end boundary
+  const uint64_t prefetched = TestGetTickerCount(options, BLOCK_CACHE_DATA_ADD);
+  ASSERT_GE(prefetched, 10U);
+  ASSERT_LE(prefetched, 11U);
+  ASSERT_EQ(prefetched, MockCache::high_pri_insert_count);
+  ASSERT_EQ(0U, MockCache::low_pri_insert_count);
+
+  // Cached blocks are not read again
+  ASSERT_OK(db_->PrefetchRange(read_options, db_->DefaultColumnFamily(),
+                               prefetch_options, &begin_slice, &end_slice));
+  ASSERT_EQ(prefetched, TestGetTickerCount(options, BLOCK_CACHE_DATA_ADD));
+
+  // Reads of the range are served from the block cache
+  const uint64_t misses = TestGetTickerCount(options, BLOCK_CACHE_DATA_MISS);
+  for (int i = 10; i <= 19; i++) {
+    ASSERT_EQ(value, Get(Key(i)));
+  }
+  ASSERT_EQ(misses, TestGetTickerCount(options, BLOCK_CACHE_DATA_MISS));
+  ASSERT_EQ(value, Get(Key(50)));
+  ASSERT_EQ(misses + 1, TestGetTickerCount(options, BLOCK_CACHE_DATA_MISS));
+}
+
+TEST_F(DBBlockCacheTest, ReloadFromBlockCacheManifest) {
+  BlockBasedTableOptions table_options = GetTableOptions();
+  table_options.block_cache = NewLRUCache(8 << 20);
+  Options options = GetOptions(table_options);
+  options.compression = kNoCompression;
+  // Only written explicitly and on close in this test
+  options.block_cache_manifest_period_sec = 3600;
+  DestroyAndReopen(options);
+  const std::string value(kValueSize, 'a');
+  for (int i = 0; i < 100; i++) {
+    ASSERT_OK(Put(Key(i), value));
+  }
+  ASSERT_OK(Flush());
+  for (int i = 10; i < 20; i++) {
+    ASSERT_EQ(value, Get(Key(i)));
+  }
+  ASSERT_OK(dbfull()->TEST_WriteBlockCacheManifest());
+  ASSERT_OK(env_->FileExists(BlockCacheManifestFileName(dbname_)));
+
+  // The blocks read before the restart are reloaded into the new cache
+  table_options.block_cache = NewLRUCache(8 << 20);
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  ASSERT_OK(options.statistics->Reset());
+  Reopen(options);
+  dbfull()->TEST_WaitForBlockCacheReload();
+  ASSERT_EQ(10U, TestGetTickerCount(options, BLOCK_CACHE_DATA_ADD));
+  const uint64_t misses = TestGetTickerCount(options, BLOCK_CACHE_DATA_MISS);
+  for (int i = 10; i < 20; i++) {
+    ASSERT_EQ(value, Get(Key(i)));
+  }
+  ASSERT_EQ(misses, TestGetTickerCount(options, BLOCK_CACHE_DATA_MISS));
+
+  // Blocks of files that no longer exist are skipped. The manifest is left
+  // alone while the option is disabled.
+  options.block_cache_manifest_period_sec = 0;
+  Reopen(options);
+  for (int i = 0; i < 100; i++) {
+    ASSERT_OK(Put(Key(i), value));
+  }
+  ASSERT_OK(Flush());
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  table_options.block_cache = NewLRUCache(8 << 20);
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  options.block_cache_manifest_period_sec = 3600;
+  Close();
+  ASSERT_OK(options.statistics->Reset());
+  Reopen(options);
+  dbfull()->TEST_WaitForBlockCacheReload();
+  ASSERT_EQ(0U, TestGetTickerCount(options, BLOCK_CACHE_DATA_ADD));
+
+  // A corrupted manifest is ignored
+  Close();
+  ASSERT_OK(WriteStringToFile(env_, "garbage",
+                              BlockCacheManifestFileName(dbname_)));
+  Reopen(options);
+  dbfull()->TEST_WaitForBlockCacheReload();
+  ASSERT_EQ(value, Get(Key(0)));
+}
+
 namespace {
 
 // An LRUCache wrapper that can falsely report "not found" on Lookup.
@@ -4385,6 +4385,70 @@ TEST_F(DBBloomFilterTest, FixedWidthSegments) {
   EXPECT_EQ(0, TestGetAndResetTickerCount(options, NON_LAST_LEVEL_SEEK_DATA));
 }
 
+TEST_F(DBBloomFilterTest, RangeFilter) {
+  Options options = CurrentOptions();
+  options.statistics = CreateDBStatistics();
+  BlockBasedTableOptions table_options;
+  table_options.filter_policy.reset(NewBloomFilterPolicy(10));
+  table_options.range_filter_prefix_lengths = {4, 7};
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  DestroyAndReopen(options);
+
+  // Keys are "u<user><item>", with items only for even users
+  auto user_key = [](int user) {
+    char buf[8];
+    snprintf(buf, sizeof(buf), "u%03d", user);
+    return std::string(buf);
+  };
+  for (int user = 0; user < 100; user += 2) {
+    for (int item = 0; item < 5; item++) {
+      ASSERT_OK(Put(user_key(user) + std::to_string(100 + item), "val"));
+    }
+  }
+  ASSERT_OK(Flush());
+
+  auto count_range = [&](const std::string& lower, const std::string& upper) {
+    ReadOptions ro;
+    Slice upper_bound = upper;
+    ro.iterate_upper_bound = &upper_bound;
+    std::unique_ptr<Iterator> iter(db_->NewIterator(ro));
+    int count = 0;
+    for (iter->Seek(lower); iter->Valid(); iter->Next()) {
+      count++;
+    }
+    EXPECT_OK(iter->status());
+    return count;
+  };
+
+  ASSERT_EQ(count_range("u042", "u042~"), 5);
+  EXPECT_EQ(1, TestGetAndResetTickerCount(options, NON_LAST_LEVEL_SEEK_DATA));
+  ASSERT_EQ(count_range("u042103", "u042103~"), 1);
+  EXPECT_EQ(1, TestGetAndResetTickerCount(options, NON_LAST_LEVEL_SEEK_DATA));
+
+  // Empty ranges within a covered prefix are filtered, up to false positives
+  for (int user = 1; user < 100; user += 2) {
+    ASSERT_EQ(count_range(user_key(user), user_key(user) + "~"), 0);
+  }
+  uint64_t filtered =
+      TestGetAndResetTickerCount(options, NON_LAST_LEVEL_SEEK_FILTERED);
+  EXPECT_GE(filtered, 45);
+  EXPECT_EQ(50 - filtered,
+            TestGetAndResetTickerCount(options, NON_LAST_LEVEL_SEEK_DATA));
+  ASSERT_EQ(count_range("u042107", "u042107~"), 0);
+
+  // Bounds without a covered common prefix are not filtered
+  ASSERT_EQ(count_range("u041", "u043"), 5);
+  EXPECT_EQ(0,
+            TestGetAndResetTickerCount(options, NON_LAST_LEVEL_SEEK_FILTERED));
+
+  // Still used after reopening, in the last level
+  Reopen(options);
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  ASSERT_EQ(count_range("u043", "u043~"), 0);
+  EXPECT_EQ(1, TestGetAndResetTickerCount(options, LAST_LEVEL_SEEK_FILTERED));
+  ASSERT_EQ(count_range("u044", "u044~"), 5);
+}
+
 }  // namespace ROCKSDB_NAMESPACE
 
 int main(int argc, char** argv) {
@@ -1005,6 +1005,47 @@ TEST_F(DBCompactionTest, MinorCompactionsHappen) {
   } while (ChangeCompactOptions());
 }
 
+TEST_F(DBCompactionTest, HybridCompactionStyle) {
+  Options options = CurrentOptions();
+  options.compaction_style = kCompactionStyleHybrid;
+  options.num_levels = 3;
+  options.compaction_options_hybrid.num_leveled_levels = 2;
+  // Needs L0 and a tiered level above the two leveled levels.
+  ASSERT_TRUE(TryReopen(options).IsNotSupported());
+
+  options.num_levels = 5;
+  options.write_buffer_size = 100 << 10;  // 100KB
+  options.level0_file_num_compaction_trigger = 2;
+  options.compaction_options_hybrid.size_ratio = 3;
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  std::map<std::string, std::string> expected;
+  for (int i = 0; i < 30; i++) {
+    for (int j = 0; j < 20; j++) {
+      std::string key = Key(rnd.Uniform(500));
+      std::string value = rnd.RandomString(1000);
+      ASSERT_OK(Put(key, value));
+      expected[key] = value;
+    }
+    ASSERT_OK(Flush());
+  }
+  ASSERT_OK(dbfull()->TEST_WaitForCompact());
+  ASSERT_GT(NumTableFilesAtLevel(options.num_levels - 1), 0);
+  for (const auto& kv : expected) {
+    ASSERT_EQ(kv.second, Get(kv.first));
+  }
+
+  // Manual compaction moves everything into the last level.
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  for (int level = 0; level < options.num_levels - 1; level++) {
+    ASSERT_EQ(0, NumTableFilesAtLevel(level));
+  }
+  for (const auto& kv : expected) {
+    ASSERT_EQ(kv.second, Get(kv.first));
+  }
+}
+
 TEST_F(DBCompactionTest, UserKeyCrossFile1) {
   Options options = CurrentOptions();
   options.compaction_style = kCompactionStyleLevel;
@@ -28,6 +28,7 @@
 
 #include "db/arena_wrapped_db_iter.h"
 #include "db/attribute_group_iterator_impl.h"
+#include "db/block_cache_manifest.h"
 #include "db/builder.h"
 #include "db/coalescing_iterator.h"
 #include "db/compaction/compaction_job.h"
@@ -89,10 +90,12 @@
 #include "rocksdb/stats_history.h"
 #include "rocksdb/status.h"
 #include "rocksdb/table.h"
+#include "rocksdb/threadpool.h"
 #include "rocksdb/version.h"
 #include "rocksdb/write_buffer_manager.h"
 #include "table/block_based/block.h"
 #include "table/block_based/block_based_table_factory.h"
+#include "table/block_based/block_based_table_reader.h"
 #include "table/get_context.h"
 #include "table/merging_iterator.h"
 #include "table/multiget_context.h"
@@ -241,6 +244,10 @@ DBImpl::DBImpl(const DBOptions& options, const std::string& dbname,
   // dealt with
   co.hash_seed = 0;
   table_cache_ = NewLRUCache(co);
+  if (immutable_db_options_.negative_lookup_cache && !read_only) {
+    negative_lookup_cache_.reset(
+        new NegativeLookupCache(immutable_db_options_.negative_lookup_cache));
+  }
   SetDbSessionId();
   assert(!db_session_id_.empty());
 
@@ -253,6 +260,9 @@ DBImpl::DBImpl(const DBOptions& options, const std::string& dbname,
   periodic_task_functions_.emplace(
       PeriodicTaskType::kRecordSeqnoTime,
       [this]() { this->RecordSeqnoToTimeMapping(); });
+  periodic_task_functions_.emplace(
+      PeriodicTaskType::kPersistBlockCacheManifest,
+      [this]() { this->PersistBlockCacheManifest(); });
 
   versions_.reset(new VersionSet(
       dbname_, &immutable_db_options_, file_options_, table_cache_.get(),
@@ -529,6 +539,16 @@ Status DBImpl::CloseHelper() {
   if (HasPendingManualCompaction()) {
     DisableManualCompaction();
   }
+
+  // Record the final block cache contents for the next open
+  if (block_cache_manifest_started_) {
+    Status manifest_s = WriteBlockCacheManifest();
+    if (!manifest_s.ok()) {
+      ROCKS_LOG_WARN(immutable_db_options_.info_log,
+                     "Failed to write block cache manifest on close: %s",
+                     manifest_s.ToString().c_str());
+    }
+  }
   mutex_.Lock();
   // Unschedule all tasks for this DB
   for (uint8_t i = 0; i < static_cast<uint8_t>(TaskType::kCount); i++) {
@@ -542,7 +562,7 @@ Status DBImpl::CloseHelper() {
   // Wait for background work to finish
   while (bg_bottom_compaction_scheduled_ || bg_compaction_scheduled_ ||
          bg_flush_scheduled_ || bg_purge_scheduled_ ||
-         pending_purge_obsolete_files_ ||
+         bg_block_cache_reload_scheduled_ || pending_purge_obsolete_files_ ||
          error_handler_.IsRecoveryInProgress()) {
     TEST_SYNC_POINT("DBImpl::~DBImpl:WaitJob");
     bg_cv_.Wait();
@@ -861,6 +881,25 @@ Status DBImpl::RegisterRecordSeqnoTimeWorker() {
   return s;
 }
 
+Status DBImpl::StartBlockCacheManifestWorker() {
+  const uint64_t period_sec =
+      immutable_db_options_.block_cache_manifest_period_sec;
+  if (period_sec == 0) {
+    return Status::OK();
+  }
+  {
+    InstrumentedMutexLock l(&mutex_);
+    block_cache_manifest_started_ = true;
+    bg_block_cache_reload_scheduled_++;
+    env_->Schedule(&DBImpl::BGWorkBlockCacheReload, this, Env::Priority::LOW,
+                   nullptr);
+  }
+  return periodic_task_scheduler_.Register(
+      PeriodicTaskType::kPersistBlockCacheManifest,
+      periodic_task_functions_.at(PeriodicTaskType::kPersistBlockCacheManifest),
+      period_sec);
+}
+
 Status DBImpl::CancelPeriodicTaskScheduler() {
   Status s = Status::OK();
   for (uint8_t task_type = 0;
@@ -1128,6 +1167,189 @@ void DBImpl::FlushInfoLog() {
   LogFlush(immutable_db_options_.info_log);
 }
 
+void DBImpl::PersistBlockCacheManifest() {
+  if (shutdown_initiated_) {
+    return;
+  }
+  TEST_SYNC_POINT("DBImpl::PersistBlockCacheManifest:StartRunning");
+  Status s = WriteBlockCacheManifest();
+  if (!s.ok()) {
+    ROCKS_LOG_WARN(immutable_db_options_.info_log,
+                   "Failed to write block cache manifest: %s",
+                   s.ToString().c_str());
+  }
+}
+
+Status DBImpl::WriteBlockCacheManifest() {
+  BlockCacheManifestBuilder builder;
+  UnorderedSet<Cache*> caches;
+  // Only the files with an open table reader can have blocks in the cache
+  ReadOptions read_options;
+  {
+    InstrumentedMutexLock l(&mutex_);
+    for (auto cfd : versions_->GetRefedColumnFamilySet()) {
+      if (!cfd->initialized() || cfd->IsDropped()) {
+        continue;
+      }
+      auto* table_factory =
+          cfd->GetCurrentMutableCFOptions().table_factory.get();
+      assert(table_factory != nullptr);
+      Cache* cache =
+          table_factory->GetOptions<Cache>(TableFactory::kBlockCacheOpts());
+      if (cache == nullptr) {
+        continue;
+      }
+      caches.insert(cache);
+
+      InstrumentedMutexUnlock u(&mutex_);
+      SuperVersion* sv = GetAndRefSuperVersion(cfd);
+      const VersionStorageInfo* vstorage = sv->current->storage_info();
+      for (int level = 0; level < vstorage->num_non_empty_levels(); level++) {
+        for (FileMetaData* file : vstorage->LevelFiles(level)) {
+          std::shared_ptr<const TableProperties> props;
+          Status s = cfd->table_cache()->GetTableProperties(
+              file_options_, read_options, cfd->internal_comparator(), *file,
+              &props, sv->mutable_cf_options, /*no_io=*/true);
+          if (!s.ok()) {
+            continue;
+          }
+          OffsetableCacheKey base_cache_key;
+          BlockBasedTable::SetupBaseCacheKey(props.get(), db_session_id_,
+                                             file->fd.GetNumber(),
+                                             &base_cache_key);
+          builder.AddFile(cfd->GetID(), level, file->fd.GetNumber(),
+                          base_cache_key);
+        }
+      }
+      ReturnAndCleanupSuperVersion(cfd, sv);
+    }
+  }
+  for (Cache* cache : caches) {
+    builder.AddCachedBlocks(cache);
+  }
+  std::vector<BlockCacheManifestEntry> entries = builder.Finish();
+  std::string contents;
+  EncodeBlockCacheManifest(entries, &contents);
+
+  // Replace the previous manifest atomically
+  const std::string fname = BlockCacheManifestFileName(dbname_);
+  const std::string tmp_fname = fname + "." + kTempFileNameSuffix;
+  IOOptions io_options;
+  IOStatus io_s = WriteStringToFile(fs_.get(), contents, tmp_fname,
+                                    /*should_sync=*/true, io_options);
+  if (io_s.ok()) {
+    io_s = fs_->RenameFile(tmp_fname, fname, io_options, nullptr);
+  }
+  if (io_s.ok()) {
+    ROCKS_LOG_INFO(immutable_db_options_.info_log,
+                   "Wrote block cache manifest with %" ROCKSDB_PRIszt
+                   " blocks",
+                   entries.size());
+  }
+  return io_s;
+}
+
+void DBImpl::BGWorkBlockCacheReload(void* db) {
+  IOSTATS_SET_THREAD_POOL_ID(Env::Priority::LOW);
+  TEST_SYNC_POINT("DBImpl::BGWorkBlockCacheReload:start");
+  static_cast<DBImpl*>(db)->BackgroundCallBlockCacheReload();
+}
+
+void DBImpl::BackgroundCallBlockCacheReload() {
+  Status s = ReloadBlockCache();
+  if (!s.ok()) {
+    ROCKS_LOG_WARN(immutable_db_options_.info_log,
+                   "Block cache reload stopped: %s", s.ToString().c_str());
+  }
+
+  mutex_.Lock();
+  assert(bg_block_cache_reload_scheduled_ > 0);
+  bg_block_cache_reload_scheduled_--;
+  bg_cv_.SignalAll();
+  // IMPORTANT: there should be no code after calling SignalAll, other than
+  // releasing the mutex. See BackgroundCallPurge().
+  mutex_.Unlock();
+}
+
+Status DBImpl::ReloadBlockCache() {
+  const std::string fname = BlockCacheManifestFileName(dbname_);
+  IOOptions io_options;
+  IOStatus io_s = fs_->FileExists(fname, io_options, nullptr);
+  if (io_s.IsNotFound()) {
+    return Status::OK();
+  }
+  std::string contents;
+  if (io_s.ok()) {
+    io_s = ReadFileToString(fs_.get(), fname, io_options, &contents);
+  }
+  if (!io_s.ok()) {
+    return io_s;
+  }
+  std::vector<BlockCacheManifestEntry> entries;
+  Status s = DecodeBlockCacheManifest(contents, &entries);
+  if (!s.ok()) {
+    return s;
+  }
+
+  // Blocks are read in the background at low priority
+  ReadOptions read_options;
+  read_options.rate_limiter_priority = Env::IO_LOW;
+  size_t num_files = 0;
+  std::vector<uint64_t> offsets;
+  // The entries of each file are adjacent, in offset order
+  for (size_t i = 0, end = 0; i < entries.size(); i = end) {
+    const uint32_t cf_id = entries[i].cf_id;
+    const uint64_t file_number = entries[i].file_number;
+    offsets.clear();
+    for (end = i; end < entries.size() && entries[end].cf_id == cf_id &&
+                  entries[end].file_number == file_number;
+         end++) {
+      if (entries[end].role == CacheEntryRole::kDataBlock) {
+        offsets.push_back(entries[end].offset);
+      }
+    }
+    if (shutting_down_.load(std::memory_order_acquire)) {
+      return Status::ShutdownInProgress();
+    }
+
+    ColumnFamilyData* cfd;
+    {
+      InstrumentedMutexLock l(&mutex_);
+      cfd = versions_->GetColumnFamilySet()->GetColumnFamily(cf_id);
+      if (cfd == nullptr || cfd->IsDropped() || !cfd->initialized()) {
+        continue;
+      }
+      cfd->Ref();
+    }
+    SuperVersion* sv = GetAndRefSuperVersion(cfd);
+    // Files compacted away since the manifest was written are skipped
+    const FileMetaData* file =
+        sv->current->storage_info()->GetFileMetaDataByNumber(file_number);
+    if (file != nullptr) {
+      // Opening the table loads its index and filter as configured, and
+      // the data blocks bring in the partitions covering them
+      s = cfd->table_cache()->LoadDataBlocks(read_options,
+                                             cfd->internal_comparator(),
+                                             *file, sv->mutable_cf_options,
+                                             offsets);
+      num_files++;
+    }
+    ReturnAndCleanupSuperVersion(cfd, sv);
+    {
+      InstrumentedMutexLock l(&mutex_);
+      cfd->UnrefAndTryDelete();
+    }
+    if (!s.ok()) {
+      return s;
+    }
+  }
+  ROCKS_LOG_INFO(immutable_db_options_.info_log,
+                 "Reloaded block cache from manifest of %" ROCKSDB_PRIszt
+                 " blocks in %" ROCKSDB_PRIszt " live files",
+                 entries.size(), num_files);
+  return Status::OK();
+}
+
 Status DBImpl::TablesRangeTombstoneSummary(ColumnFamilyHandle* column_family,
                                            int max_entries_to_print,
                                            std::string* out_str) {
@@ -2431,11 +2653,52 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
   TEST_SYNC_POINT("DBImpl::GetImpl:3");
   TEST_SYNC_POINT("DBImpl::GetImpl:4");
 
+  // A cached miss is only valid for reads that could see everything the
+  // original read did
+  NegativeLookupCache* const negative_lookup_cache =
+      (get_impl_options.get_value &&
+       get_impl_options.callback == nullptr &&
+       get_impl_options.is_blob_index == nullptr &&
+       read_options.read_tier == kReadAllTier &&
+       !read_options.ignore_range_deletions)
+          ? negative_lookup_cache_.get()
+          : nullptr;
+  if (negative_lookup_cache != nullptr) {
+    if (negative_lookup_cache->Lookup(cfd->GetID(), key, snapshot,
+                                      sv->external_write_generation)) {
+      RecordTick(stats_, NEGATIVE_LOOKUP_CACHE_HIT);
+      RecordTick(stats_, NUMBER_KEYS_READ);
+      ReturnAndCleanupSuperVersion(cfd, sv);
+      RecordInHistogram(stats_, BYTES_PER_READ, 0);
+      return Status::NotFound();
+    }
+    RecordTick(stats_, NEGATIVE_LOOKUP_CACHE_MISS);
+  }
+
   // Prepare to store a list of merge operations if merge occurs.
   MergeContext merge_context;
   merge_context.get_merge_operands_options =
       get_impl_options.get_merge_operands_options;
   SequenceNumber max_covering_tombstone_seq = 0;
+  // With the range tombstone index, the range tombstones of the immutable
+  // memtables and SST files are found with one search up front, so they skip
+  // their own
+  std::optional<ReadOptions> index_read_options;
+  if (sv->mutable_cf_options.range_tombstone_index_for_point_lookups &&
+      !read_options.ignore_range_deletions &&
+      read_options.read_tier == kReadAllTier &&
+      get_impl_options.callback == nullptr && ucmp == BytewiseComparator()) {
+    FragmentedRangeTombstoneList* index = sv->GetRangeTombstoneIndex();
+    if (index != nullptr) {
+      FragmentedRangeTombstoneIterator index_iter(
+          index, cfd->internal_comparator(), snapshot);
+      max_covering_tombstone_seq = index_iter.MaxCoveringTombstoneSeqnum(key);
+      index_read_options.emplace(read_options);
+      index_read_options->ignore_range_deletions = true;
+    }
+  }
+  const ReadOptions& lsm_read_options =
+      index_read_options.has_value() ? *index_read_options : read_options;
 
   Status s;
   // First look in the memtable, then in the immutable memtable (if any).
@@ -2474,7 +2737,7 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
                                   : nullptr,
                               get_impl_options.columns, timestamp, &s,
                               &merge_context, &max_covering_tombstone_seq,
-                              read_options, get_impl_options.callback,
+                              lsm_read_options, get_impl_options.callback,
                               get_impl_options.is_blob_index)) {
         done = true;
 
@@ -2497,7 +2760,7 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
       } else if ((s.ok() || s.IsMergeInProgress()) &&
                  sv->imm->GetMergeOperands(lkey, &s, &merge_context,
                                            &max_covering_tombstone_seq,
-                                           read_options)) {
+                                           lsm_read_options)) {
         done = true;
         RecordTick(stats_, MEMTABLE_HIT);
       }
@@ -2514,9 +2777,9 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
   if (!done) {
     PERF_TIMER_GUARD(get_from_output_files_time);
     sv->current->Get(
-        read_options, lkey, get_impl_options.value, get_impl_options.columns,
-        timestamp, &s, &merge_context, &max_covering_tombstone_seq,
-        &pinned_iters_mgr,
+        lsm_read_options, lkey, get_impl_options.value,
+        get_impl_options.columns, timestamp, &s, &merge_context,
+        &max_covering_tombstone_seq, &pinned_iters_mgr,
         get_impl_options.get_value ? get_impl_options.value_found : nullptr,
         nullptr, nullptr,
         get_impl_options.get_value ? get_impl_options.callback : nullptr,
@@ -2612,6 +2875,9 @@ Status DBImpl::GetImpl(const ReadOptions& read_options, const Slice& key,
       }
       RecordTick(stats_, BYTES_READ, size);
       PERF_COUNTER_ADD(get_read_bytes, size);
+    } else if (s.IsNotFound() && negative_lookup_cache != nullptr) {
+      negative_lookup_cache->Insert(cfd->GetID(), key, snapshot,
+                                    sv->external_write_generation);
     }
 
     ReturnAndCleanupSuperVersion(cfd, sv);
@@ -3036,6 +3302,71 @@ void DB::MultiGet(const ReadOptions& options, ColumnFamilyHandle* column_family,
   }
 }
 
+namespace {
+class AsyncReadHandleImpl : public AsyncReadHandle {
+ public:
+  // Shared with the thread pool job, which may outlive the handle
+  struct State {
+    State() : cv(&mutex) {}
+
+    void SetReady() {
+      MutexLock l(&mutex);
+      ready.store(true, std::memory_order_release);
+      cv.SignalAll();
+    }
+
+    port::Mutex mutex;
+    port::CondVar cv;
+    std::atomic<bool> ready{false};
+  };
+
+  AsyncReadHandleImpl() : state_(std::make_shared<State>()) {}
+  ~AsyncReadHandleImpl() override { Wait(); }
+
+  bool IsReady() const override {
+    return state_->ready.load(std::memory_order_acquire);
+  }
+
+  void Wait() override {
+    MutexLock l(&state_->mutex);
+    while (!state_->ready.load(std::memory_order_relaxed)) {
+      state_->cv.Wait();
+    }
+  }
+
+  const std::shared_ptr<State>& state() const { return state_; }
+
+ private:
+  std::shared_ptr<State> state_;
+};
+}  // namespace
+
+std::unique_ptr<AsyncReadHandle> DB::MultiGetAsync(
+    const ReadOptions& options, ColumnFamilyHandle* column_family,
+    size_t num_keys, const Slice* keys, PinnableSlice* values,
+    Status* statuses, ThreadPool* thread_pool,
+    std::function<void()> callback) {
+  auto handle = std::make_unique<AsyncReadHandleImpl>();
+  // The caller only needs to keep the key data alive, not the Slices
+  std::vector<Slice> key_slices(keys, keys + num_keys);
+  auto job = [this, options, column_family,
+              key_slices = std::move(key_slices), values, statuses,
+              callback = std::move(callback), state = handle->state()]() {
+    MultiGet(options, column_family, key_slices.size(), key_slices.data(),
+             values, statuses);
+    state->SetReady();
+    if (callback) {
+      callback();
+    }
+  };
+  if (thread_pool == nullptr) {
+    job();
+  } else {
+    thread_pool->SubmitJob(std::move(job));
+  }
+  return handle;
+}
+
 void DBImpl::MultiGetCommon(const ReadOptions& read_options,
                             ColumnFamilyHandle* column_family,
                             const size_t num_keys, const Slice* keys,
@@ -4451,6 +4782,41 @@ Status DBImpl::GetPropertiesOfTablesInRange(ColumnFamilyHandle* column_family,
   return s;
 }
 
+Status DBImpl::PrefetchRange(const ReadOptions& options,
+                             ColumnFamilyHandle* column_family,
+                             const PrefetchRangeOptions& prefetch_options,
+                             const Slice* begin, const Slice* end) {
+  if (!options.fill_cache) {
+    return Status::InvalidArgument("PrefetchRange requires fill_cache");
+  }
+  if (options.read_tier == kBlockCacheTier) {
+    return Status::InvalidArgument("PrefetchRange requires I/O");
+  }
+  auto cfh = static_cast_with_check<ColumnFamilyHandleImpl>(column_family);
+  auto cfd = cfh->cfd();
+  const Comparator* const ucmp = cfd->user_comparator();
+  assert(ucmp);
+  size_t ts_sz = ucmp->timestamp_size();
+  std::string begin_with_ts, end_with_ts;
+  auto [start, limit] = MaybeAddTimestampsToRange(
+      OptSlice::CopyFromPtr(begin), OptSlice::CopyFromPtr(end), ts_sz,
+      &begin_with_ts, &end_with_ts, /*exclusive_end=*/false);
+  InternalKey begin_key, end_key;
+  if (start.has_value()) {
+    begin_key.SetMinPossibleForUserKey(start.value());
+  }
+  if (limit.has_value()) {
+    end_key.SetMaxPossibleForUserKey(limit.value());
+  }
+
+  SuperVersion* sv = GetAndRefSuperVersion(cfd);
+  Status s = sv->current->PrefetchRange(
+      options, prefetch_options, start.has_value() ? &begin_key : nullptr,
+      limit.has_value() ? &end_key : nullptr);
+  ReturnAndCleanupSuperVersion(cfd, sv);
+  return s;
+}
+
 Status DBImpl::GetPropertiesOfTablesByLevel(
     ColumnFamilyHandle* column_family,
     std::vector<std::unique_ptr<TablePropertiesCollection>>* props_by_level) {
@@ -5302,6 +5668,7 @@ Status DestroyDB(const std::string& dbname, const Options& options,
         }
       }
     }
+    env->DeleteFile(BlockCacheManifestFileName(dbname)).PermitUncheckedError();
     paths_to_delete.insert(dbname);
 
     std::set<std::string> paths;
@@ -6099,6 +6466,7 @@ Status DBImpl::IngestExternalFiles(
       for (size_t i = 0; i != num_cfs; ++i) {
         auto* cfd = ingestion_jobs[i].GetColumnFamilyData();
         assert(!cfd->IsDropped());
+        cfd->BumpExternalWriteGeneration();
         InstallSuperVersionAndScheduleWork(cfd, &sv_ctxs[i]);
 #ifndef NDEBUG
         if (0 == i && num_cfs > 1) {
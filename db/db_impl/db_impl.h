@@ -34,6 +34,7 @@
 #include "db/log_writer.h"
 #include "db/logs_with_prep_tracker.h"
 #include "db/memtable_list.h"
+#include "db/negative_lookup_cache.h"
 #include "db/periodic_task_scheduler.h"
 #include "db/post_memtable_callback.h"
 #include "db/pre_release_callback.h"
@@ -388,6 +389,12 @@ class DBImpl : public DB {
       const ReadOptions& _read_options, ColumnFamilyHandle* column_family,
       const std::vector<ScanOptions>& scan_opts) override;
 
+  using DB::ParallelScan;
+  Status ParallelScan(const ReadOptions& _read_options,
+                      ColumnFamilyHandle* column_family,
+                      const ParallelScanOptions& scan_opts,
+                      const ParallelScanCallback& callback) override;
+
   const Snapshot* GetSnapshot() override;
   void ReleaseSnapshot(const Snapshot* snapshot) override;
 
@@ -573,6 +580,11 @@ class DBImpl : public DB {
   void GetAllColumnFamilyMetaData(
       std::vector<ColumnFamilyMetaData>* metadata) override;
 
+  Status PrefetchRange(const ReadOptions& options,
+                       ColumnFamilyHandle* column_family,
+                       const PrefetchRangeOptions& prefetch_options,
+                       const Slice* begin, const Slice* end) override;
+
   Status SuggestCompactRange(ColumnFamilyHandle* column_family,
                              const Slice* begin, const Slice* end) override;
 
@@ -1128,6 +1140,11 @@ class DBImpl : public DB {
 
   VersionSet* GetVersionSet() const { return versions_.get(); }
 
+  // nullptr unless DBOptions::negative_lookup_cache is set
+  NegativeLookupCache* negative_lookup_cache() const {
+    return negative_lookup_cache_.get();
+  }
+
   Status WaitForCompact(
       const WaitForCompactOptions& wait_for_compact_options) override;
 
@@ -1165,6 +1182,11 @@ class DBImpl : public DB {
   // Wait for background threads to complete scheduled work.
   Status TEST_WaitForBackgroundWork();
 
+  Status TEST_WriteBlockCacheManifest();
+
+  // Wait for the block cache reload scheduled by DB::Open to finish
+  void TEST_WaitForBlockCacheReload();
+
   // Wait for memtable compaction
   Status TEST_WaitForFlushMemTable(ColumnFamilyHandle* column_family = nullptr);
 
@@ -1283,6 +1305,17 @@ class DBImpl : public DB {
   // flush LOG out of application buffer
   void FlushInfoLog();
 
+  // rewrite the block cache manifest, for the background timer job
+  void PersistBlockCacheManifest();
+
+  // Records the blocks of live SST files found in the block cache to the
+  // block cache manifest file
+  Status WriteBlockCacheManifest();
+
+  // Reads the blocks listed in the block cache manifest file, if any, into
+  // the block cache
+  Status ReloadBlockCache();
+
   // For the background timer job
   void RecordSeqnoToTimeMapping();
 
@@ -1396,6 +1429,9 @@ class DBImpl : public DB {
   // table_cache_ provides its own synchronization
   std::shared_ptr<Cache> table_cache_;
 
+  // Provides its own synchronization
+  std::unique_ptr<NegativeLookupCache> negative_lookup_cache_;
+
   ErrorHandler error_handler_;
 
   // Unified interface for logging events
@@ -2441,12 +2477,14 @@ class DBImpl : public DB {
   static void BGWorkBottomCompaction(void* arg);
   static void BGWorkFlush(void* arg);
   static void BGWorkPurge(void* arg);
+  static void BGWorkBlockCacheReload(void* arg);
   static void UnscheduleCompactionCallback(void* arg);
   static void UnscheduleFlushCallback(void* arg);
   void BackgroundCallCompaction(PrepickedCompaction* prepicked_compaction,
                                 Env::Priority thread_pri);
   void BackgroundCallFlush(Env::Priority thread_pri);
   void BackgroundCallPurge();
+  void BackgroundCallBlockCacheReload();
   Status BackgroundCompaction(bool* madeProgress, JobContext* job_context,
                               LogBuffer* log_buffer,
                               PrepickedCompaction* prepicked_compaction,
@@ -2480,6 +2518,11 @@ class DBImpl : public DB {
 
   Status RegisterRecordSeqnoTimeWorker();
 
+  // Schedules the block cache reload from the block cache manifest and its
+  // periodic rewrite, if enabled. See
+  // DBOptions::block_cache_manifest_period_sec.
+  Status StartBlockCacheManifestWorker();
+
   void PrintStatistics();
 
   size_t EstimateInMemoryStatsHistorySize() const;
@@ -3016,6 +3059,13 @@ class DBImpl : public DB {
   // number of background obsolete file purge jobs, submitted to the HIGH pool
   int bg_purge_scheduled_ = 0;
 
+  // number of background block cache reload jobs, submitted to the LOW pool
+  int bg_block_cache_reload_scheduled_ = 0;
+
+  // whether the block cache manifest is maintained by this DB, which is
+  // only the case for a DB opened for writes
+  bool block_cache_manifest_started_ = false;
+
   std::deque<ManualCompactionState*> manual_compaction_dequeue_;
 
   // shall we disable deletion of obsolete files
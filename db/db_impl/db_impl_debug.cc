@@ -105,6 +105,7 @@ Status DBImpl::TEST_CompactRange(int level, const Slice* begin,
   }
   int output_level =
       (cfd->ioptions().compaction_style == kCompactionStyleUniversal ||
+       cfd->ioptions().compaction_style == kCompactionStyleHybrid ||
        cfd->ioptions().compaction_style == kCompactionStyleFIFO)
           ? level
           : level + 1;
@@ -169,6 +170,17 @@ Status DBImpl::TEST_WaitForBackgroundWork() {
   return error_handler_.GetBGError();
 }
 
+Status DBImpl::TEST_WriteBlockCacheManifest() {
+  return WriteBlockCacheManifest();
+}
+
+void DBImpl::TEST_WaitForBlockCacheReload() {
+  InstrumentedMutexLock l(&mutex_);
+  while (bg_block_cache_reload_scheduled_) {
+    bg_cv_.Wait();
+  }
+}
+
 Status DBImpl::TEST_WaitForFlushMemTable(ColumnFamilyHandle* column_family) {
   ColumnFamilyData* cfd;
   if (column_family == nullptr) {
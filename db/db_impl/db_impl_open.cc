@@ -272,6 +272,11 @@ Status DBImpl::ValidateOptions(const DBOptions& db_options) {
         "unordered_write is incompatible with enable_pipelined_write");
   }
 
+  if (db_options.unordered_write && db_options.negative_lookup_cache) {
+    return Status::InvalidArgument(
+        "unordered_write is incompatible with negative_lookup_cache");
+  }
+
   if (db_options.atomic_flush && db_options.enable_pipelined_write) {
     return Status::InvalidArgument(
         "atomic_flush is incompatible with enable_pipelined_write");
@@ -2698,6 +2703,9 @@ Status DBImpl::Open(const DBOptions& db_options, const std::string& dbname,
   if (s.ok()) {
     s = impl->RegisterRecordSeqnoTimeWorker();
   }
+  if (s.ok()) {
+    s = impl->StartBlockCacheManifestWorker();
+  }
   impl->options_mutex_.Unlock();
   if (s.ok()) {
     *dbptr = std::move(impl);
@@ -0,0 +1,318 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "db/column_family.h"
+#include "db/db_impl/db_impl.h"
+#include "db/table_cache.h"
+#include "port/port.h"
+#include "rocksdb/snapshot.h"
+#include "rocksdb/threadpool.h"
+#include "util/cast_util.h"
+#include "util/mutexlock.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+namespace {
+using KeyValueBatch = std::vector<std::pair<std::string, std::string>>;
+
+// State shared by the sub-range scans of a DBImpl::ParallelScan() call
+class ParallelScanState {
+ public:
+  ParallelScanState(size_t num_partitions, const ParallelScanOptions& scan_opts,
+                    const ParallelScanCallback& callback)
+      : scan_opts_(scan_opts),
+        callback_(callback),
+        cv_(&mutex_),
+        queues_(num_partitions),
+        finished_(num_partitions, false),
+        num_running_(num_partitions) {}
+
+  const ParallelScanOptions& scan_opts() const { return scan_opts_; }
+
+  bool stopped() const { return stopped_.load(std::memory_order_relaxed); }
+
+  // Passes a batch of `partition` to the callback, or queues it for
+  // DeliverInOrder(). Returns false if the scan was stopped.
+  bool Deliver(size_t partition, KeyValueBatch* batch) {
+    if (!scan_opts_.ordered) {
+      Status s = callback_(partition, *batch);
+      batch->clear();
+      if (!s.ok()) {
+        MutexLock l(&mutex_);
+        SetErrorLocked(s);
+      }
+      return !stopped();
+    }
+    MutexLock l(&mutex_);
+    std::deque<KeyValueBatch>& queue = queues_[partition];
+    while (!stopped() && queue.size() >= scan_opts_.max_buffered_batches) {
+      cv_.Wait();
+    }
+    if (stopped()) {
+      return false;
+    }
+    queue.push_back(std::move(*batch));
+    batch->clear();
+    cv_.SignalAll();
+    return true;
+  }
+
+  // Called once the scan of `partition` is done, with its read status
+  void Finish(size_t partition, const Status& s) {
+    MutexLock l(&mutex_);
+    if (!s.ok()) {
+      SetErrorLocked(s);
+    }
+    finished_[partition] = true;
+    num_running_--;
+    cv_.SignalAll();
+  }
+
+  // For ordered scans, passes the queued batches to the callback in partition
+  // order until all are delivered or the scan is stopped.
+  void DeliverInOrder() {
+    assert(scan_opts_.ordered);
+    MutexLock l(&mutex_);
+    size_t partition = 0;
+    while (partition < queues_.size() && !stopped()) {
+      std::deque<KeyValueBatch>& queue = queues_[partition];
+      if (!queue.empty()) {
+        KeyValueBatch batch = std::move(queue.front());
+        queue.pop_front();
+        cv_.SignalAll();
+        mutex_.Unlock();
+        Status s = callback_(partition, batch);
+        mutex_.Lock();
+        if (!s.ok()) {
+          SetErrorLocked(s);
+        }
+      } else if (finished_[partition]) {
+        partition++;
+      } else {
+        cv_.Wait();
+      }
+    }
+  }
+
+  // Waits for all the sub-range scans to finish, and returns the first error
+  Status WaitForAll() {
+    MutexLock l(&mutex_);
+    while (num_running_ > 0) {
+      cv_.Wait();
+    }
+    return status_;
+  }
+
+ private:
+  void SetErrorLocked(const Status& s) {
+    mutex_.AssertHeld();
+    if (status_.ok()) {
+      status_ = s;
+    }
+    stopped_.store(true, std::memory_order_relaxed);
+    cv_.SignalAll();
+  }
+
+  const ParallelScanOptions& scan_opts_;
+  const ParallelScanCallback& callback_;
+  std::atomic<bool> stopped_{false};
+
+  port::Mutex mutex_;
+  port::CondVar cv_;
+  // Batches waiting to be delivered, for ordered scans
+  std::vector<std::deque<KeyValueBatch>> queues_;
+  std::vector<bool> finished_;
+  size_t num_running_;
+  Status status_;
+};
+
+void ScanPartition(DB* db, ReadOptions read_options,
+                   ColumnFamilyHandle* column_family, const OptSlice& lower,
+                   const OptSlice& upper, size_t partition,
+                   ParallelScanState* state) {
+  read_options.iterate_lower_bound = lower.AsPtr();
+  read_options.iterate_upper_bound = upper.AsPtr();
+  std::unique_ptr<Iterator> iter(db->NewIterator(read_options, column_family));
+  KeyValueBatch batch;
+  size_t batch_bytes = 0;
+  bool stopped = false;
+  if (lower.has_value()) {
+    iter->Seek(*lower);
+  } else {
+    iter->SeekToFirst();
+  }
+  for (; iter->Valid(); iter->Next()) {
+    if (state->stopped()) {
+      stopped = true;
+      break;
+    }
+    batch.emplace_back(iter->key().ToString(), iter->value().ToString());
+    batch_bytes += iter->key().size() + iter->value().size();
+    if (batch_bytes >= state->scan_opts().batch_size) {
+      if (!state->Deliver(partition, &batch)) {
+        stopped = true;
+        break;
+      }
+      batch_bytes = 0;
+    }
+  }
+  Status s = iter->status();
+  if (s.ok() && !stopped && !batch.empty()) {
+    state->Deliver(partition, &batch);
+  }
+  state->Finish(partition, s);
+}
+}  // namespace
+
+Status DBImpl::ParallelScan(const ReadOptions& _read_options,
+                            ColumnFamilyHandle* column_family,
+                            const ParallelScanOptions& scan_opts,
+                            const ParallelScanCallback& callback) {
+  if (scan_opts.max_partitions == 0) {
+    return Status::InvalidArgument("max_partitions must be positive");
+  }
+  if (scan_opts.ordered && scan_opts.max_buffered_batches == 0) {
+    return Status::InvalidArgument(
+        "max_buffered_batches must be positive for ordered scans");
+  }
+  if (!callback) {
+    return Status::InvalidArgument("callback must be set");
+  }
+  assert(column_family);
+  auto cfh = static_cast_with_check<ColumnFamilyHandleImpl>(column_family);
+  ColumnFamilyData* cfd = cfh->cfd();
+  const Comparator* ucmp = cfd->user_comparator();
+  const size_t ts_sz = ucmp->timestamp_size();
+  const OptSlice& start = scan_opts.range.start;
+  const OptSlice& limit = scan_opts.range.limit;
+
+  // All sub-ranges are read from the same snapshot
+  ReadOptions read_options(_read_options);
+  std::unique_ptr<ManagedSnapshot> snapshot;
+  if (read_options.snapshot == nullptr) {
+    snapshot.reset(new ManagedSnapshot(this));
+    read_options.snapshot = snapshot->snapshot();
+  }
+
+  // Split the range like subcompactions do: ask each overlapping SST file for
+  // anchor keys that evenly partition it, and cut the sorted anchors into
+  // groups of roughly equal size.
+  std::vector<std::string> boundaries;
+  if (scan_opts.max_partitions > 1) {
+    std::vector<TableReader::Anchor> anchors;
+    uint64_t total_size = 0;
+    SuperVersion* sv = GetAndRefSuperVersion(cfd);
+    const VersionStorageInfo* vstorage = sv->current->storage_info();
+    for (int level = 0; level < vstorage->num_non_empty_levels(); level++) {
+      for (FileMetaData* f : vstorage->LevelFiles(level)) {
+        if ((start.has_value() &&
+             ucmp->CompareWithoutTimestamp(f->largest.user_key(), true, *start,
+                                           false) < 0) ||
+            (limit.has_value() &&
+             ucmp->CompareWithoutTimestamp(f->smallest.user_key(), true,
+                                           *limit, false) >= 0)) {
+          continue;
+        }
+        std::vector<TableReader::Anchor> file_anchors;
+        Status s = cfd->table_cache()->ApproximateKeyAnchors(
+            read_options, cfd->internal_comparator(), *f,
+            sv->mutable_cf_options, file_anchors);
+        if (!s.ok() || file_anchors.empty()) {
+          file_anchors.clear();
+          file_anchors.emplace_back(f->largest.user_key(),
+                                    f->fd.GetFileSize());
+        }
+        for (TableReader::Anchor& anchor : file_anchors) {
+          anchor.user_key =
+              StripTimestampFromUserKey(anchor.user_key, ts_sz).ToString();
+          // A boundary must leave a non-empty range on both sides
+          if ((start.has_value() &&
+               ucmp->CompareWithoutTimestamp(anchor.user_key, false, *start,
+                                             false) <= 0) ||
+              (limit.has_value() &&
+               ucmp->CompareWithoutTimestamp(anchor.user_key, false, *limit,
+                                             false) >= 0)) {
+            continue;
+          }
+          total_size += anchor.range_size;
+          anchors.push_back(std::move(anchor));
+        }
+      }
+    }
+    ReturnAndCleanupSuperVersion(cfd, sv);
+
+    auto less = [ucmp](const TableReader::Anchor& a,
+                       const TableReader::Anchor& b) {
+      return ucmp->CompareWithoutTimestamp(a.user_key, false, b.user_key,
+                                           false) < 0;
+    };
+    auto equal = [ucmp](const TableReader::Anchor& a,
+                        const TableReader::Anchor& b) {
+      return ucmp->CompareWithoutTimestamp(a.user_key, false, b.user_key,
+                                           false) == 0;
+    };
+    std::sort(anchors.begin(), anchors.end(), less);
+    anchors.erase(std::unique(anchors.begin(), anchors.end(), equal),
+                  anchors.end());
+
+    const uint64_t target_size = total_size / scan_opts.max_partitions;
+    uint64_t next_threshold = target_size;
+    uint64_t cumulative_size = 0;
+    for (TableReader::Anchor& anchor : anchors) {
+      if (boundaries.size() + 1 >= scan_opts.max_partitions) {
+        break;
+      }
+      cumulative_size += anchor.range_size;
+      if (cumulative_size > next_threshold) {
+        next_threshold += target_size;
+        boundaries.push_back(std::move(anchor.user_key));
+      }
+    }
+  }
+
+  const size_t num_partitions = boundaries.size() + 1;
+  ParallelScanState state(num_partitions, scan_opts, callback);
+  auto scan = [&](size_t partition) {
+    ScanPartition(this, read_options, column_family,
+                  partition == 0 ? start : OptSlice(boundaries[partition - 1]),
+                  partition + 1 == num_partitions
+                      ? limit
+                      : OptSlice(boundaries[partition]),
+                  partition, &state);
+  };
+  std::vector<port::Thread> threads;
+  // Unless batches are delivered from this thread, it scans the first
+  // sub-range itself
+  size_t first_async = scan_opts.ordered ? 0 : 1;
+  if (scan_opts.thread_pool != nullptr) {
+    for (size_t i = first_async; i < num_partitions; i++) {
+      scan_opts.thread_pool->SubmitJob([&scan, i]() { scan(i); });
+    }
+  } else {
+    threads.reserve(num_partitions - first_async);
+    for (size_t i = first_async; i < num_partitions; i++) {
+      threads.emplace_back(scan, i);
+    }
+  }
+  if (scan_opts.ordered) {
+    state.DeliverInOrder();
+  } else {
+    scan(0);
+  }
+  for (port::Thread& thread : threads) {
+    thread.join();
+  }
+  return state.WaitForAll();
+}
+
+}  // namespace ROCKSDB_NAMESPACE
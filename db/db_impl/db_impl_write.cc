@@ -2734,6 +2734,8 @@ Status DBImpl::SwitchMemtable(ColumnFamilyData* cfd, WriteContext* context,
     // AssignAtomicFlushSeq().
     new_imm->SetNextLogNumber(cur_wal_number_);
     cfd->imm()->Add(new_imm, &context->memtables_to_free_);
+    // The ingested memtable bypassed the memtable write path
+    cfd->BumpExternalWriteGeneration();
   }
   new_mem->Ref();
   cfd->SetMemtable(new_mem);
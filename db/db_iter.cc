@@ -48,6 +48,7 @@ DBIter::DBIter(Env* _env, const ReadOptions& read_options,
       clock_(ioptions.clock),
       logger_(ioptions.logger),
       user_comparator_(cmp),
+      icomp_(cmp),
       merge_operator_(ioptions.merge_operator.get()),
       iter_(iter),
       blob_reader_(version, read_options.read_tier,
@@ -217,6 +218,21 @@ void DBIter::Next() {
   }
 }
 
+// Same as Iterator::NextBatch(), but the calls below are not virtual since
+// DBIter is final
+void DBIter::NextBatch(size_t max_entries, size_t max_bytes,
+                       IteratorBatch* batch) {
+  batch->Clear();
+  while (valid_ && batch->size() < max_entries &&
+         batch->data_size() < max_bytes) {
+    if (!PrepareValue()) {
+      break;
+    }
+    batch->Add(key(), value());
+    Next();
+  }
+}
+
 Status DBIter::BlobReader::RetrieveAndSetBlobValue(const Slice& user_key,
                                                    const Slice& blob_index) {
   assert(blob_value_.empty());
@@ -603,7 +619,13 @@ bool DBIter::FindNextUserEntryInternal(bool skipping_saved_key,
               *timestamp_ub_);
         }
       }
-      iter_.Seek(last_key);
+      // Only the child iterators still positioned before last_key need to
+      // move, so avoid a full Seek() when that is known to be the case.
+      if (icomp_.Compare(iter_.key(), last_key) < 0) {
+        iter_.SeekForward(last_key);
+      } else {
+        iter_.Seek(last_key);
+      }
       RecordTick(statistics_, NUMBER_OF_RESEEKS_IN_ITERATION);
     } else {
       iter_.Next();
@@ -221,6 +221,8 @@ class DBIter final : public Iterator {
   Status GetProperty(std::string prop_name, std::string* prop) override;
 
   void Next() final override;
+  void NextBatch(size_t max_entries, size_t max_bytes,
+                 IteratorBatch* batch) final override;
   void Prev() final override;
   // 'target' does not contain timestamp, even if user timestamp feature is
   // enabled.
@@ -453,6 +455,7 @@ class DBIter final : public Iterator {
   SystemClock* clock_;
   Logger* logger_;
   UserComparatorWrapper user_comparator_;
+  const InternalKeyComparator icomp_;
   const MergeOperator* const merge_operator_;
   IteratorWrapper iter_;
   BlobReader blob_reader_;
@@ -15,7 +15,9 @@
 #include "port/port.h"
 #include "port/stack_trace.h"
 #include "rocksdb/iostats_context.h"
+#include "rocksdb/multi_scan.h"
 #include "rocksdb/perf_context.h"
+#include "rocksdb/threadpool.h"
 #include "table/block_based/flush_block_policy_impl.h"
 #include "util/random.h"
 #include "utilities/merge_operators/string_append/stringappend2.h"
@@ -4139,6 +4141,280 @@ TEST_P(DBIteratorTest, AverageMemtableOpsScanFlushTriggerByOverwrites) {
   ASSERT_OK(db_->WaitForCompact({}));
   ASSERT_EQ(1, NumTableFilesAtLevel(0));
 }
+
+TEST_F(DBIteratorTest, MultiScanPrepareReadsDataBlocks) {
+  Options options = CurrentOptions();
+  options.statistics = CreateDBStatistics();
+  options.compression = kNoCompression;
+  options.disable_auto_compactions = true;
+  BlockBasedTableOptions table_options;
+  table_options.block_size = 256;
+  table_options.block_cache = NewLRUCache(8 << 20);
+  options.table_factory.reset(NewBlockBasedTableFactory(table_options));
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  for (int i = 0; i < 1000; i++) {
+    ASSERT_OK(Put(Key(i), rnd.RandomString(100)));
+  }
+  ASSERT_OK(Flush());
+  // One file read through LevelIterator, one directly
+  MoveFilesToLevel(1);
+  for (int i = 0; i < 1000; i += 2) {
+    ASSERT_OK(Put(Key(i), rnd.RandomString(100)));
+  }
+  ASSERT_OK(Flush());
+
+  std::vector<std::string> bounds = {Key(100), Key(110), Key(500),
+                                     Key(520), Key(900), Key(905)};
+  std::vector<ScanOptions> scan_options;
+  for (size_t i = 0; i < bounds.size(); i += 2) {
+    scan_options.emplace_back(bounds[i], bounds[i + 1]);
+  }
+  ASSERT_OK(options.statistics->Reset());
+  get_perf_context()->Reset();
+  SetPerfLevel(kEnableCount);
+  std::unique_ptr<MultiScan> iter =
+      db_->NewMultiScan(ReadOptions(), db_->DefaultColumnFamily(),
+                        scan_options);
+  // All the data blocks of the scans are read up front
+  uint64_t prepared_misses =
+      options.statistics->getTickerCount(BLOCK_CACHE_DATA_MISS);
+  ASSERT_GT(prepared_misses, 0);
+  ASSERT_EQ(options.statistics->getTickerCount(BLOCK_CACHE_DATA_ADD),
+            prepared_misses);
+  ASSERT_EQ(get_perf_context()->block_read_count, prepared_misses);
+
+  int idx = 0;
+  int count = 0;
+  for (auto range : *iter) {
+    for (auto it : range) {
+      ASSERT_GE(it.first.ToString(), bounds[idx]);
+      ASSERT_LT(it.first.ToString(), bounds[idx + 1]);
+      count++;
+    }
+    idx += 2;
+  }
+  ASSERT_EQ(count, 35);
+  ASSERT_EQ(options.statistics->getTickerCount(BLOCK_CACHE_DATA_MISS),
+            prepared_misses);
+  SetPerfLevel(kDisable);
+}
+
+TEST_P(DBIteratorTest, ReseekPastManyVersions) {
+  Options options = CurrentOptions();
+  options.statistics = CreateDBStatistics();
+  options.disable_auto_compactions = true;
+  options.max_sequential_skip_in_iterations = 3;
+  DestroyAndReopen(options);
+
+  for (int i = 0; i < 20; i++) {
+    ASSERT_OK(Put(Key(i), "base" + std::to_string(i)));
+  }
+  ASSERT_OK(Flush());
+  MoveFilesToLevel(2);
+  // A range tombstone read through a LevelIterator
+  ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(),
+                             Key(5), Key(8)));
+  ASSERT_OK(Put(Key(19), "new19"));
+  ASSERT_OK(Flush());
+  MoveFilesToLevel(1);
+
+  // Many versions of a key in an L0 file and of another key in the memtable
+  std::vector<const Snapshot*> snapshots;
+  for (int v = 0; v < 50; v++) {
+    snapshots.push_back(db_->GetSnapshot());
+    ASSERT_OK(Put(Key(10), "v" + std::to_string(v)));
+  }
+  ASSERT_OK(Put(Key(6), "new6"));
+  ASSERT_OK(Flush());
+  for (int v = 0; v < 50; v++) {
+    snapshots.push_back(db_->GetSnapshot());
+    ASSERT_OK(Put(Key(12), "v" + std::to_string(v)));
+  }
+  snapshots.push_back(nullptr);
+
+  for (const Snapshot* snapshot : {snapshots[0], snapshots[20], snapshots[70],
+                                   snapshots.back()}) {
+    ReadOptions ro;
+    ro.snapshot = snapshot;
+    std::string expected;
+    for (int i = 0; i < 20; i++) {
+      std::string value;
+      Status s = db_->Get(ro, Key(i), &value);
+      if (s.ok()) {
+        expected += Key(i) + "=" + value + ",";
+      } else {
+        ASSERT_TRUE(s.IsNotFound());
+      }
+    }
+    std::string actual;
+    std::unique_ptr<Iterator> iter(NewIterator(ro));
+    for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+      actual += iter->key().ToString() + "=" + iter->value().ToString() + ",";
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(expected, actual);
+  }
+  ASSERT_GT(TestGetTickerCount(options, NUMBER_OF_RESEEKS_IN_ITERATION), 0);
+
+  for (const Snapshot* snapshot : snapshots) {
+    if (snapshot != nullptr) {
+      db_->ReleaseSnapshot(snapshot);
+    }
+  }
+}
+
+TEST_P(DBIteratorTest, NextBatch) {
+  Options options = CurrentOptions();
+  options.disable_auto_compactions = true;
+  DestroyAndReopen(options);
+
+  for (int i = 0; i < 100; i++) {
+    ASSERT_OK(Put(Key(i), "v" + std::to_string(i)));
+  }
+  ASSERT_OK(Flush());
+  MoveFilesToLevel(1);
+  for (int i = 0; i < 100; i += 3) {
+    ASSERT_OK(Delete(Key(i)));
+  }
+  ASSERT_OK(Flush());
+  for (int i = 0; i < 100; i += 5) {
+    ASSERT_OK(Put(Key(i), "new" + std::to_string(i)));
+  }
+
+  std::string upper_bound = Key(90);
+  Slice upper_bound_slice(upper_bound);
+  ReadOptions ro;
+  ro.iterate_upper_bound = &upper_bound_slice;
+  std::vector<std::pair<std::string, std::string>> expected;
+  std::unique_ptr<Iterator> iter(NewIterator(ro));
+  for (iter->Seek(Key(10)); iter->Valid(); iter->Next()) {
+    expected.emplace_back(iter->key().ToString(), iter->value().ToString());
+  }
+  ASSERT_OK(iter->status());
+
+  for (size_t max_bytes : {size_t{1} << 20, size_t{50}}) {
+    std::vector<std::pair<std::string, std::string>> actual;
+    IteratorBatch batch;
+    iter->Seek(Key(10));
+    while (iter->Valid()) {
+      iter->NextBatch(7 /* max_entries */, max_bytes, &batch);
+      ASSERT_FALSE(batch.empty());
+      ASSERT_LE(batch.size(), 7U);
+      // Only the last entry may cross max_bytes
+      ASSERT_LT(batch.data_size() - batch.key(batch.size() - 1).size() -
+                    batch.value(batch.size() - 1).size(),
+                max_bytes);
+      for (size_t i = 0; i < batch.size(); i++) {
+        actual.emplace_back(batch.key(i).ToString(), batch.value(i).ToString());
+      }
+      // The iterator is left at the entry after the batch
+      if (actual.size() < expected.size()) {
+        ASSERT_TRUE(iter->Valid());
+        ASSERT_EQ(iter->key(), expected[actual.size()].first);
+      }
+    }
+    ASSERT_OK(iter->status());
+    ASSERT_EQ(expected, actual);
+
+    iter->NextBatch(7 /* max_entries */, max_bytes, &batch);
+    ASSERT_TRUE(batch.empty());
+  }
+}
+
+TEST_F(DBIteratorTest, ParallelScan) {
+  Options options = CurrentOptions();
+  options.disable_auto_compactions = true;
+  DestroyAndReopen(options);
+
+  Random rnd(301);
+  std::vector<std::pair<std::string, std::string>> expected;
+  for (int i = 0; i < 1000; i++) {
+    expected.emplace_back(Key(i), rnd.RandomString(100));
+    ASSERT_OK(Put(expected.back().first, expected.back().second));
+    if (i % 100 == 99) {
+      ASSERT_OK(Flush());
+    }
+  }
+  MoveFilesToLevel(1);
+  // Not visible to the scans below
+  const Snapshot* snapshot = db_->GetSnapshot();
+  ASSERT_OK(Put(Key(1000), "after snapshot"));
+
+  ReadOptions ro;
+  ro.snapshot = snapshot;
+  ParallelScanOptions scan_opts;
+  scan_opts.max_partitions = 4;
+  scan_opts.batch_size = 1000;
+
+  // Unordered, on threads created for the scan
+  port::Mutex mutex;
+  std::map<size_t, std::vector<std::pair<std::string, std::string>>>
+      by_partition;
+  ASSERT_OK(db_->ParallelScan(
+      ro, db_->DefaultColumnFamily(), scan_opts,
+      [&](size_t partition,
+          std::vector<std::pair<std::string, std::string>>& batch) {
+        MutexLock l(&mutex);
+        auto& kvs = by_partition[partition];
+        std::move(batch.begin(), batch.end(), std::back_inserter(kvs));
+        return Status::OK();
+      }));
+  ASSERT_GT(by_partition.size(), 1);
+  std::vector<std::pair<std::string, std::string>> actual;
+  for (auto& partition : by_partition) {
+    ASSERT_FALSE(partition.second.empty());
+    actual.insert(actual.end(), partition.second.begin(),
+                  partition.second.end());
+  }
+  ASSERT_EQ(expected, actual);
+
+  // Ordered over a sub-range, on a thread pool with fewer threads than
+  // sub-ranges
+  std::unique_ptr<ThreadPool> thread_pool(NewThreadPool(2));
+  scan_opts.thread_pool = thread_pool.get();
+  scan_opts.ordered = true;
+  scan_opts.max_buffered_batches = 1;
+  std::string start = Key(150);
+  std::string limit = Key(850);
+  scan_opts.range = RangeOpt(start, limit);
+  actual.clear();
+  size_t last_partition = 0;
+  ASSERT_OK(db_->ParallelScan(
+      ro, db_->DefaultColumnFamily(), scan_opts,
+      [&](size_t partition,
+          std::vector<std::pair<std::string, std::string>>& batch) {
+        EXPECT_GE(partition, last_partition);
+        last_partition = partition;
+        actual.insert(actual.end(), batch.begin(), batch.end());
+        return Status::OK();
+      }));
+  ASSERT_GT(last_partition, 0);
+  expected.erase(expected.begin() + 850, expected.end());
+  expected.erase(expected.begin(), expected.begin() + 150);
+  ASSERT_EQ(expected, actual);
+
+  // An error from the callback stops the scan
+  int num_batches = 0;
+  Status s = db_->ParallelScan(
+      ro, db_->DefaultColumnFamily(), scan_opts,
+      [&](size_t, std::vector<std::pair<std::string, std::string>>&) {
+        return ++num_batches == 3 ? Status::Aborted("stop") : Status::OK();
+      });
+  ASSERT_TRUE(s.IsAborted());
+  ASSERT_EQ(num_batches, 3);
+
+  scan_opts.max_partitions = 0;
+  ASSERT_TRUE(db_->ParallelScan(ro, db_->DefaultColumnFamily(), scan_opts,
+                                [](size_t, std::vector<std::pair<
+                                               std::string, std::string>>&) {
+                                  return Status::OK();
+                                })
+                  .IsInvalidArgument());
+  thread_pool->JoinAllThreads();
+  db_->ReleaseSnapshot(snapshot);
+}
 }  // namespace ROCKSDB_NAMESPACE
 
 int main(int argc, char** argv) {
@@ -810,6 +810,74 @@ TEST_F(DBRangeDelTest, GetIgnoresRangeDeletions) {
   db_->ReleaseSnapshot(snapshot);
 }
 
+TEST_F(DBRangeDelTest, RangeTombstoneIndexForPointLookups) {
+  Options options = CurrentOptions();
+  options.disable_auto_compactions = true;
+  options.max_write_buffer_number = 4;
+  options.min_write_buffer_number_to_merge = 3;
+  DestroyAndReopen(options);
+
+  // Overlapping keys and range tombstones in L2, L1, L0, an immutable and the
+  // mutable memtable
+  const int kNumKeys = 200;
+  Random rnd(301);
+  std::vector<const Snapshot*> snapshots{nullptr};
+  for (int round = 0; round < 5; round++) {
+    for (int i = 0; i < kNumKeys; i += 1 + rnd.Uniform(3)) {
+      ASSERT_OK(Put(Key(i), "v" + std::to_string(round)));
+    }
+    for (int j = 0; j < 5; j++) {
+      int start = rnd.Uniform(kNumKeys);
+      ASSERT_OK(db_->DeleteRange(WriteOptions(), db_->DefaultColumnFamily(),
+                                 Key(start),
+                                 Key(start + 1 + rnd.Uniform(20))));
+    }
+    snapshots.push_back(db_->GetSnapshot());
+    if (round < 3) {
+      ASSERT_OK(Flush());
+      if (round < 2) {
+        MoveFilesToLevel(2 - round);
+      }
+    } else if (round == 3) {
+      ASSERT_OK(dbfull()->TEST_SwitchMemtable());
+    }
+  }
+  ASSERT_EQ("1,1,1", FilesPerLevel());
+
+  auto get_all = [&](const Snapshot* snapshot) {
+    ReadOptions read_opts;
+    read_opts.snapshot = snapshot;
+    std::vector<std::string> results;
+    for (int i = 0; i < kNumKeys + 20; i++) {
+      std::string value;
+      Status s = db_->Get(read_opts, Key(i), &value);
+      EXPECT_TRUE(s.ok() || s.IsNotFound());
+      results.push_back(s.ok() ? value : "NOT_FOUND");
+    }
+    return results;
+  };
+  std::vector<std::vector<std::string>> expected;
+  for (const Snapshot* snapshot : snapshots) {
+    expected.push_back(get_all(snapshot));
+  }
+  ASSERT_OK(db_->SetOptions({{"range_tombstone_index_for_point_lookups",
+                              "true"}}));
+  for (size_t i = 0; i < snapshots.size(); i++) {
+    ASSERT_EQ(expected[i], get_all(snapshots[i]));
+  }
+  ASSERT_GT(std::count(expected[0].begin(), expected[0].end(), "NOT_FOUND"),
+            20);
+
+  // The index is rebuilt for the new files after a compaction
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  ASSERT_EQ(expected[0], get_all(nullptr));
+  for (const Snapshot* snapshot : snapshots) {
+    if (snapshot != nullptr) {
+      db_->ReleaseSnapshot(snapshot);
+    }
+  }
+}
+
 TEST_F(DBRangeDelTest, IteratorRemovesCoveredKeys) {
   const int kNum = 200, kRangeBegin = 50, kRangeEnd = 150, kNumPerFile = 25;
   Options opts = CurrentOptions();
@@ -5775,6 +5775,89 @@ TEST_F(DBTest2, RowCacheSnapshot) {
   db_->ReleaseSnapshot(s3);
 }
 
+TEST_F(DBTest2, NegativeLookupCache) {
+  Options options = CurrentOptions();
+  options.statistics = ROCKSDB_NAMESPACE::CreateDBStatistics();
+  options.negative_lookup_cache = NewLRUCache(8 * 8192);
+  options.merge_operator = MergeOperators::CreateStringAppendOperator();
+  DestroyAndReopen(options);
+
+  auto hits = [&]() {
+    return TestGetTickerCount(options, NEGATIVE_LOOKUP_CACHE_HIT);
+  };
+
+  ASSERT_OK(Put("a", "va"));
+  ASSERT_EQ(Get("b"), "NOT_FOUND");
+  ASSERT_EQ(hits(), 0);
+  ASSERT_EQ(TestGetTickerCount(options, NEGATIVE_LOOKUP_CACHE_MISS), 1);
+  ASSERT_EQ(Get("b"), "NOT_FOUND");
+  ASSERT_EQ(hits(), 1);
+  // Found keys are not cached
+  ASSERT_EQ(Get("a"), "va");
+  ASSERT_EQ(Get("a"), "va");
+  ASSERT_EQ(hits(), 1);
+
+  // Flushes, compactions and deletions of other keys keep the entry valid
+  ASSERT_OK(Delete("a"));
+  ASSERT_OK(Flush());
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+  ASSERT_EQ(Get("b"), "NOT_FOUND");
+  ASSERT_EQ(hits(), 2);
+
+  // A write to the key invalidates the entry, while older snapshots still see
+  // the key as absent
+  const Snapshot* snapshot = db_->GetSnapshot();
+  ASSERT_OK(Put("b", "vb"));
+  ASSERT_EQ(Get("b"), "vb");
+  ASSERT_EQ(Get("b", snapshot), "NOT_FOUND");
+  ASSERT_EQ(hits(), 2);
+  db_->ReleaseSnapshot(snapshot);
+
+  // A cached miss is not used by reads at an older snapshot
+  snapshot = db_->GetSnapshot();
+  ASSERT_OK(Delete("b"));
+  ASSERT_EQ(Get("b"), "NOT_FOUND");
+  ASSERT_EQ(Get("b"), "NOT_FOUND");
+  ASSERT_EQ(hits(), 3);
+  ASSERT_EQ(Get("b", snapshot), "vb");
+  db_->ReleaseSnapshot(snapshot);
+
+  // Merges invalidate the entry
+  ASSERT_OK(Merge("b", "m"));
+  ASSERT_EQ(Get("b"), "m");
+  ASSERT_EQ(hits(), 3);
+
+  // Ingesting a file invalidates all entries of the column family
+  ASSERT_EQ(Get("c"), "NOT_FOUND");
+  ASSERT_EQ(Get("c"), "NOT_FOUND");
+  ASSERT_EQ(hits(), 4);
+  SstFileWriter sst_file_writer{EnvOptions(), options};
+  std::string external_file = dbname_ + "/negative_lookup_cache.sst";
+  ASSERT_OK(sst_file_writer.Open(external_file));
+  ASSERT_OK(sst_file_writer.Put("c", "vc"));
+  ASSERT_OK(sst_file_writer.Finish());
+  ASSERT_OK(db_->IngestExternalFile({external_file},
+                                    IngestExternalFileOptions()));
+  ASSERT_EQ(Get("c"), "vc");
+  ASSERT_EQ(hits(), 4);
+
+  // Entries are per column family
+  options.statistics = ROCKSDB_NAMESPACE::CreateDBStatistics();
+  CreateAndReopenWithCF({"pikachu"}, options);
+  ASSERT_EQ(Get(1, "d"), "NOT_FOUND");
+  ASSERT_EQ(Get(1, "d"), "NOT_FOUND");
+  ASSERT_EQ(hits(), 1);
+  ASSERT_OK(Put(0, "d", "vd"));
+  ASSERT_EQ(Get(1, "d"), "NOT_FOUND");
+  ASSERT_EQ(hits(), 2);
+  ASSERT_EQ(Get(0, "d"), "vd");
+
+  options.unordered_write = true;
+  ASSERT_TRUE(TryReopenWithColumnFamilies({kDefaultColumnFamilyName, "pikachu"},
+                                          options)
+                  .IsInvalidArgument());
+}
+
 // When DB is reopened with multiple column families, the manifest file
 // is written after the first CF is flushed, and it is written again
 // after each flush. If DB crashes between the flushes, the flushed CF
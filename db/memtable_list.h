@@ -110,6 +110,12 @@ class MemTableListVersion {
   Status AddRangeTombstoneIterators(const ReadOptions& read_opts, Arena* arena,
                                     RangeDelAggregator* range_del_agg);
 
+  // Adds an iterator over the range tombstones of each memtable that has any
+  void AddRangeTombstoneIterators(
+      const ReadOptions& read_opts,
+      std::vector<std::unique_ptr<FragmentedRangeTombstoneIterator>>*
+          range_del_iters);
+
   void AddIterators(const ReadOptions& options,
                     UnownedPtr<const SeqnoToTimeMapping> seqno_to_time_mapping,
                     const SliceTransform* prefix_extractor,
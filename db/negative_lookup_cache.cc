@@ -0,0 +1,63 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "db/negative_lookup_cache.h"
+
+#include "util/coding.h"
+#include "util/hash.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+NegativeLookupCache::NegativeLookupCache(const std::shared_ptr<Cache>& cache)
+    : cache_(cache),
+      latest_write_(new std::atomic<SequenceNumber>[kNumStripes]) {
+  PutVarint64(&cache_id_, cache->NewId());
+  for (size_t i = 0; i < kNumStripes; i++) {
+    latest_write_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+size_t NegativeLookupCache::StripeOf(uint32_t cf_id, const Slice& user_key) {
+  return static_cast<size_t>(Hash64(user_key.data(), user_key.size(), cf_id)) &
+         (kNumStripes - 1);
+}
+
+void NegativeLookupCache::MakeKey(uint32_t cf_id, const Slice& user_key,
+                                  std::string* key) const {
+  key->reserve(cache_id_.size() + 5 + user_key.size());
+  key->assign(cache_id_);
+  PutVarint32(key, cf_id);
+  key->append(user_key.data(), user_key.size());
+}
+
+bool NegativeLookupCache::Lookup(uint32_t cf_id, const Slice& user_key,
+                                 SequenceNumber seq, uint64_t generation) {
+  std::string key;
+  MakeKey(cf_id, user_key, &key);
+  auto handle = cache_.Lookup(key);
+  if (handle == nullptr) {
+    return false;
+  }
+  const Entry entry = *cache_.Value(handle);
+  cache_.Release(handle);
+  if (entry.generation != generation || seq < entry.seq) {
+    return false;
+  }
+  return latest_write_[StripeOf(cf_id, user_key)].load(
+             std::memory_order_relaxed) <= entry.seq;
+}
+
+void NegativeLookupCache::Insert(uint32_t cf_id, const Slice& user_key,
+                                 SequenceNumber seq, uint64_t generation) {
+  std::string key;
+  MakeKey(cf_id, user_key, &key);
+  auto entry = std::make_unique<Entry>(Entry{seq, generation});
+  // Replaces any older entry for the key. The cache takes ownership of the
+  // entry even if the insertion fails.
+  cache_.Insert(key, entry.release(), sizeof(Entry) + key.size())
+      .PermitUncheckedError();
+}
+
+}  // namespace ROCKSDB_NAMESPACE
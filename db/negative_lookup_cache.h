@@ -0,0 +1,86 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "cache/typed_cache.h"
+#include "db/dbformat.h"
+#include "port/port.h"
+#include "rocksdb/slice.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// Remembers point lookups that returned NotFound, so that a repeated miss for
+// a key with no writes since the last miss can be answered without searching
+// the memtables and the LSM tree. See DBOptions::negative_lookup_cache.
+//
+// Each entry records the read sequence number at which the key was found
+// absent. Writes through the memtable raise the sequence number of a striped
+// "latest write" table before they are published, so an entry remains valid
+// for a read at sequence number `seq` as long as
+//   * the read sees everything the entry saw (`seq` >= entry sequence),
+//   * no write to the key's stripe is newer than the entry, and
+//   * no file ingestion or WriteBatchWithIndex ingestion has bypassed the
+//     memtable since, tracked by SuperVersion::external_write_generation.
+// Deletions never turn an absent key into a present one, so they do not
+// invalidate entries. Hash collisions between stripes only cause spurious
+// invalidations.
+class NegativeLookupCache {
+ public:
+  explicit NegativeLookupCache(const std::shared_ptr<Cache>& cache);
+
+  NegativeLookupCache(const NegativeLookupCache&) = delete;
+  NegativeLookupCache& operator=(const NegativeLookupCache&) = delete;
+
+  // Returns true if `user_key` is known to be absent from the column family
+  // for a read at sequence number `seq` through a SuperVersion with
+  // `generation` as its external_write_generation. Must be called after the
+  // read sequence number is acquired.
+  bool Lookup(uint32_t cf_id, const Slice& user_key, SequenceNumber seq,
+              uint64_t generation);
+
+  // Records that `user_key` was found absent by a read at sequence number
+  // `seq` through a SuperVersion with `generation`.
+  void Insert(uint32_t cf_id, const Slice& user_key, SequenceNumber seq,
+              uint64_t generation);
+
+  // Called by the memtable write path for every key that may become visible,
+  // before the write's sequence number is published.
+  void OnWrite(uint32_t cf_id, const Slice& user_key, SequenceNumber seq) {
+    std::atomic<SequenceNumber>& latest =
+        latest_write_[StripeOf(cf_id, user_key)];
+    SequenceNumber cur = latest.load(std::memory_order_relaxed);
+    // The publication of `seq` by a release store orders this update before
+    // any read that can see the write.
+    while (cur < seq &&
+           !latest.compare_exchange_weak(cur, seq, std::memory_order_relaxed)) {
+    }
+  }
+
+  static constexpr size_t kNumStripes = size_t{1} << 16;
+
+ private:
+  struct Entry {
+    SequenceNumber seq;
+    uint64_t generation;
+  };
+  using CacheInterface =
+      BasicTypedSharedCacheInterface<Entry, CacheEntryRole::kMisc>;
+
+  static size_t StripeOf(uint32_t cf_id, const Slice& user_key);
+
+  void MakeKey(uint32_t cf_id, const Slice& user_key, std::string* key) const;
+
+  CacheInterface cache_;
+  // Distinguishes the entries of this DB in a shared cache
+  std::string cache_id_;
+  std::unique_ptr<std::atomic<SequenceNumber>[]> latest_write_;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
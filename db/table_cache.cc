@@ -592,6 +592,43 @@ Status TableCache::MultiGetFilter(
   return s;
 }
 
+std::unique_ptr<TableReader::MultiGetPrefetch>
+TableCache::StartMultiGetPrefetch(
+    const ReadOptions& options,
+    const InternalKeyComparator& internal_comparator,
+    const FileMetaData& file_meta, const MutableCFOptions& mutable_cf_options,
+    HistogramImpl* file_read_hist, int level, bool skip_filters,
+    const MultiGetContext::Range* mget_range, TypedHandle** table_handle) {
+  auto& fd = file_meta.fd;
+  TableReader* t = fd.table_reader;
+  TypedHandle* handle = nullptr;
+  *table_handle = nullptr;
+  if (t == nullptr) {
+    Status s = FindTable(
+        options, file_options_, internal_comparator, file_meta, &handle,
+        mutable_cf_options, options.read_tier == kBlockCacheTier /* no_io */,
+        file_read_hist, skip_filters, level,
+        true /* prefetch_index_and_filter_in_cache */,
+        /*max_file_size_for_l0_meta_pin=*/0, file_meta.temperature);
+    if (!s.ok()) {
+      // Left for MultiGet() to report
+      s.PermitUncheckedError();
+      return nullptr;
+    }
+    t = cache_.Value(handle);
+  }
+  std::unique_ptr<TableReader::MultiGetPrefetch> prefetch =
+      t->StartMultiGetPrefetch(options, mget_range,
+                               mutable_cf_options.prefix_extractor.get(),
+                               skip_filters);
+  if (prefetch) {
+    *table_handle = handle;
+  } else if (handle != nullptr) {
+    cache_.Release(handle);
+  }
+  return prefetch;
+}
+
 Status TableCache::GetTableProperties(
     const FileOptions& file_options, const ReadOptions& read_options,
     const InternalKeyComparator& internal_comparator,
@@ -643,6 +680,54 @@ Status TableCache::ApproximateKeyAnchors(
   return s;
 }
 
+Status TableCache::Prefetch(const ReadOptions& ro,
+                            const InternalKeyComparator& internal_comparator,
+                            const FileMetaData& file_meta,
+                            const MutableCFOptions& mutable_cf_options,
+                            const PrefetchRangeOptions& prefetch_options,
+                            const Slice* begin, const Slice* end) {
+  Status s;
+  TableReader* t = file_meta.fd.table_reader;
+  TypedHandle* handle = nullptr;
+  if (t == nullptr) {
+    s = FindTable(ro, file_options_, internal_comparator, file_meta, &handle,
+                  mutable_cf_options);
+    if (s.ok()) {
+      t = cache_.Value(handle);
+    }
+  }
+  if (s.ok() && t != nullptr) {
+    s = t->Prefetch(ro, begin, end, &prefetch_options);
+  }
+  if (handle != nullptr) {
+    cache_.Release(handle);
+  }
+  return s;
+}
+
+Status TableCache::LoadDataBlocks(
+    const ReadOptions& ro, const InternalKeyComparator& internal_comparator,
+    const FileMetaData& file_meta, const MutableCFOptions& mutable_cf_options,
+    const std::vector<uint64_t>& offsets) {
+  Status s;
+  TableReader* t = file_meta.fd.table_reader;
+  TypedHandle* handle = nullptr;
+  if (t == nullptr) {
+    s = FindTable(ro, file_options_, internal_comparator, file_meta, &handle,
+                  mutable_cf_options);
+    if (s.ok()) {
+      t = cache_.Value(handle);
+    }
+  }
+  if (s.ok() && t != nullptr) {
+    s = t->LoadDataBlocks(ro, offsets);
+  }
+  if (handle != nullptr) {
+    cache_.Release(handle);
+  }
+  return s;
+}
+
 size_t TableCache::GetMemoryUsageByTableReader(
     const FileOptions& file_options, const ReadOptions& read_options,
     const InternalKeyComparator& internal_comparator,
@@ -140,6 +140,19 @@ class TableCache {
                         MultiGetContext::Range* mget_range,
                         TypedHandle** table_handle);
 
+  // Starts reading the data blocks of the file that might hold the keys in
+  // mget_range into the block cache, without looking them up. Returns nullptr
+  // if nothing was started. Otherwise, the table reader must stay alive until
+  // the returned object is destroyed, so the table cache handle, if one was
+  // looked up, is returned in table_handle for the caller to release after
+  // that.
+  std::unique_ptr<TableReader::MultiGetPrefetch> StartMultiGetPrefetch(
+      const ReadOptions& options,
+      const InternalKeyComparator& internal_comparator,
+      const FileMetaData& file_meta, const MutableCFOptions& mutable_cf_options,
+      HistogramImpl* file_read_hist, int level, bool skip_filters,
+      const MultiGetContext::Range* mget_range, TypedHandle** table_handle);
+
   // If a seek to internal key "k" in specified file finds an entry,
   // call get_context->SaveValue() repeatedly until
   // it returns false. As a side effect, it will insert the TableReader
@@ -200,6 +213,23 @@ class TableCache {
                             const MutableCFOptions& mutable_cf_options,
                             bool no_io = false);
 
+  // Loads the blocks of the internal key range [*begin, *end] of the file
+  // into the block cache, see TableReader::Prefetch().
+  Status Prefetch(const ReadOptions& ro,
+                  const InternalKeyComparator& internal_comparator,
+                  const FileMetaData& file_meta,
+                  const MutableCFOptions& mutable_cf_options,
+                  const PrefetchRangeOptions& prefetch_options,
+                  const Slice* begin, const Slice* end);
+
+  // Loads the data blocks of the file at the given offsets into the block
+  // cache, see TableReader::LoadDataBlocks().
+  Status LoadDataBlocks(const ReadOptions& ro,
+                        const InternalKeyComparator& internal_comparator,
+                        const FileMetaData& file_meta,
+                        const MutableCFOptions& mutable_cf_options,
+                        const std::vector<uint64_t>& offsets);
+
   Status ApproximateKeyAnchors(const ReadOptions& ro,
                                const InternalKeyComparator& internal_comparator,
                                const FileMetaData& file_meta,
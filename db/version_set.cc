@@ -1025,6 +1025,9 @@ class LevelIterator final : public InternalIterator {
   void Next() final override;
   bool NextAndGetResult(IterateResult* result) override;
   void Prev() override;
+  // If range_tombstone_iter_ is not nullptr, stays within the current file so
+  // that no file boundary sentinel key is skipped.
+  void SeekForward(const Slice& target) override;
 
   // In addition to valid and invalid state (!file_iter.Valid() and
   // status.ok()), a third state of the iterator is when !file_iter_.Valid() and
@@ -1421,6 +1424,25 @@ void LevelIterator::Next() {
   SkipEmptyFileForward();
 }
 
+void LevelIterator::SeekForward(const Slice& target) {
+  assert(Valid());
+  if (range_tombstone_iter_ == nullptr) {
+    Seek(target);
+    return;
+  }
+  if (to_return_sentinel_ ||
+      icomparator_.InternalKeyComparator::Compare(
+          target, file_largest_key(file_index_)) > 0) {
+    // The merging iterator needs to see the sentinel key of the current file
+    // before moving past it.
+    Next();
+    return;
+  }
+  file_iter_.SeekForward(target);
+  TrySetDeleteRangeSentinel(file_largest_key(file_index_));
+  SkipEmptyFileForward();
+}
+
 bool LevelIterator::NextAndGetResult(IterateResult* result) {
   assert(Valid());
   // file_iter_ is at EOF already when to_return_sentinel_
@@ -1767,6 +1789,30 @@ Status Version::GetPropertiesOfTablesInRange(
   return Status::OK();
 }
 
+Status Version::PrefetchRange(const ReadOptions& read_options,
+                              const PrefetchRangeOptions& prefetch_options,
+                              const InternalKey* begin,
+                              const InternalKey* end) const {
+  const Slice begin_key = begin == nullptr ? Slice() : begin->Encode();
+  const Slice end_key = end == nullptr ? Slice() : end->Encode();
+  for (int level = 0; level < storage_info_.num_non_empty_levels(); level++) {
+    std::vector<FileMetaData*> files;
+    storage_info_.GetOverlappingInputs(level, begin, end, &files, -1, nullptr,
+                                       false);
+    for (const auto& file_meta : files) {
+      Status s = table_cache_->Prefetch(
+          read_options, cfd_->internal_comparator(), *file_meta,
+          mutable_cf_options_, prefetch_options,
+          begin == nullptr ? nullptr : &begin_key,
+          end == nullptr ? nullptr : &end_key);
+      if (!s.ok()) {
+        return s;
+      }
+    }
+  }
+  return Status::OK();
+}
+
 Status Version::GetPropertiesOfTablesByLevel(
     const ReadOptions& read_options,
     std::vector<std::unique_ptr<TablePropertiesCollection>>* props_by_level)
@@ -2606,6 +2652,65 @@ void Version::Get(const ReadOptions& read_options, const LookupKey& k,
   }
 }
 
+void Version::MultiGetSpeculativeReads(const ReadOptions& read_options,
+                                       MultiGetRange* range) {
+  struct FilePrefetch {
+    std::unique_ptr<TableReader::MultiGetPrefetch> prefetch;
+    TableCache::TypedHandle* table_handle;
+  };
+  std::vector<FilePrefetch> prefetches;
+  MultiGetRange file_picker_range(*range, range->begin(), range->end());
+  FilePickerMultiGet fp(&file_picker_range, &storage_info_.level_files_brief_,
+                        storage_info_.num_non_empty_levels_,
+                        &storage_info_.file_indexer_, user_comparator(),
+                        internal_comparator());
+  // Unlike the lookup, this does not stop at the first level holding a key
+  FdWithKeyRange* f = fp.GetNextFileInLevel();
+  while (!fp.IsSearchEnded()) {
+    if (f != nullptr) {
+      MultiGetRange file_range = fp.CurrentFileRange();
+      bool skip_filters = IsFilterSkipped(
+          static_cast<int>(fp.GetHitFileLevel()), fp.IsHitFileLastInLevel());
+      TableCache::TypedHandle* table_handle = nullptr;
+      std::unique_ptr<TableReader::MultiGetPrefetch> prefetch =
+          table_cache_->StartMultiGetPrefetch(
+              read_options, *internal_comparator(), *f->file_metadata,
+              mutable_cf_options_,
+              cfd_->internal_stats()->GetFileReadHist(fp.GetHitFileLevel()),
+              fp.GetHitFileLevel(), skip_filters, &file_range, &table_handle);
+      if (prefetch) {
+        prefetches.push_back({std::move(prefetch), table_handle});
+      }
+      f = fp.GetNextFileInLevel();
+    } else {
+      fp.PrepareNextLevelForSearch();
+      if (!fp.IsSearchEnded()) {
+        f = fp.GetNextFileInLevel();
+      }
+    }
+  }
+  if (prefetches.empty()) {
+    return;
+  }
+
+  std::vector<void*> io_handles;
+  for (const FilePrefetch& p : prefetches) {
+    p.prefetch->GetIOHandles(&io_handles);
+  }
+  if (!io_handles.empty()) {
+    // Failed reads are left for the lookup to retry
+    cfd_->ioptions().fs->Poll(io_handles, io_handles.size())
+        .PermitUncheckedError();
+  }
+  for (FilePrefetch& p : prefetches) {
+    p.prefetch->Finish();
+    p.prefetch.reset();
+    if (p.table_handle != nullptr) {
+      table_cache_->get_cache().Release(p.table_handle);
+    }
+  }
+}
+
 void Version::MultiGet(const ReadOptions& read_options, MultiGetRange* range,
                        ReadCallback* callback) {
   PinnedIteratorsManager pinned_iters_mgr;
@@ -2658,6 +2763,9 @@ void Version::MultiGet(const ReadOptions& read_options, MultiGetRange* range,
   } else
 #endif  // USE_COROUTINES
   {
+    if (read_options.speculative_multiget_reads) {
+      MultiGetSpeculativeReads(read_options, range);
+    }
     MultiGetRange file_picker_range(*range, range->begin(), range->end());
     FilePickerMultiGet fp(&file_picker_range, &storage_info_.level_files_brief_,
                           storage_info_.num_non_empty_levels_,
@@ -3490,10 +3598,11 @@ void VersionStorageInfo::ComputeCompactionScore(
           num_sorted_runs++;
         }
       }
-      if (compaction_style_ == kCompactionStyleUniversal) {
-        // For universal compaction, we use level0 score to indicate
-        // compaction score for the whole DB. Adding other levels as if
-        // they are L0 files.
+      if (compaction_style_ == kCompactionStyleUniversal ||
+          compaction_style_ == kCompactionStyleHybrid) {
+        // For universal and hybrid compaction, we use level0 score to
+        // indicate compaction score for the whole DB. Adding other levels as
+        // if they are L0 files.
         for (int i = 1; i <= max_output_level; i++) {
           // It's possible that a subset of the files in a level may be in a
           // compaction, due to delete triggered compaction or trivial move.
@@ -3581,6 +3690,29 @@ void VersionStorageInfo::ComputeCompactionScore(
                                  mutable_cf_options.max_bytes_for_level_base);
           }
         }
+        if (compaction_style_ == kCompactionStyleHybrid &&
+            mutable_cf_options.compaction_options_hybrid.num_leveled_levels ==
+                2) {
+          // The two leveled levels of hybrid compaction are not sorted runs
+          // that can pile up, so bound the second last level by size instead.
+          uint64_t upper_size = 0;
+          for (auto* f : files_[max_output_level - 1]) {
+            if (!f->being_compacted) {
+              upper_size += f->fd.GetFileSize();
+            }
+          }
+          uint64_t lower_size = 0;
+          for (auto* f : files_[max_output_level]) {
+            lower_size += f->fd.GetFileSize();
+          }
+          if (upper_size > 0) {
+            score = std::max(
+                score,
+                static_cast<double>(upper_size) *
+                    mutable_cf_options.compaction_options_hybrid.size_ratio /
+                    static_cast<double>(std::max<uint64_t>(lower_size, 1)));
+          }
+        }
       }
     } else {  // level > 0
       // Compute the ratio of current size to size limit.
@@ -3655,6 +3787,9 @@ void VersionStorageInfo::ComputeCompactionScore(
       mutable_cf_options.blob_garbage_collection_age_cutoff,
       mutable_cf_options.blob_garbage_collection_force_threshold,
       mutable_cf_options.enable_blob_garbage_collection);
+  ComputeBlobFilesMarkedForGarbageCollection(
+      mutable_cf_options.blob_garbage_collection_file_threshold,
+      mutable_cf_options.enable_blob_garbage_collection);
 
   EstimateCompactionBytesNeeded(mutable_cf_options);
 }
@@ -3878,6 +4013,61 @@ void VersionStorageInfo::ComputeFilesMarkedForForcedBlobGC(
   }
 }
 
+void VersionStorageInfo::ComputeBlobFilesMarkedForGarbageCollection(
+    double blob_garbage_collection_file_threshold,
+    bool enable_blob_garbage_collection) {
+  blob_files_marked_for_gc_.clear();
+  if (!(enable_blob_garbage_collection &&
+        blob_garbage_collection_file_threshold < 1.0)) {
+    return;
+  }
+
+  // Unlike the age-based batch above, each blob file is judged on its own
+  // garbage ratio. Live blobs in a selected file get relocated whenever a
+  // compaction encounters them; in addition, the SSTs linked to the file (i.e.
+  // whose oldest referenced blob file it is) are rewritten in place so the
+  // file loses its links and can be dropped once all of its blobs are garbage.
+  // Note that rewriting a linked SST always moves its oldest blob reference
+  // forward, so the selection cannot mark the same SSTs indefinitely.
+  for (const auto& meta : blob_files_) {
+    assert(meta);
+
+    const uint64_t total_blob_bytes = meta->GetTotalBlobBytes();
+    if (!total_blob_bytes ||
+        meta->GetGarbageBlobBytes() <
+            blob_garbage_collection_file_threshold * total_blob_bytes) {
+      continue;
+    }
+
+    blob_files_marked_for_gc_.emplace_back(meta->GetBlobFileNumber());
+
+    for (uint64_t sst_file_number : meta->GetLinkedSsts()) {
+      const FileLocation location = GetFileLocation(sst_file_number);
+      assert(location.IsValid());
+
+      const int level = location.GetLevel();
+      assert(level >= 0);
+
+      FileMetaData* const sst_meta = files_[level][location.GetPosition()];
+      assert(sst_meta);
+
+      if (sst_meta->being_compacted) {
+        continue;
+      }
+
+      const bool already_marked = std::any_of(
+          files_marked_for_forced_blob_gc_.begin(),
+          files_marked_for_forced_blob_gc_.end(),
+          [sst_meta](const std::pair<int, FileMetaData*>& marked) {
+            return marked.second == sst_meta;
+          });
+      if (!already_marked) {
+        files_marked_for_forced_blob_gc_.emplace_back(level, sst_meta);
+      }
+    }
+  }
+}
+
 namespace {
 
 // used to sort files by size
@@ -4099,7 +4289,8 @@ void VersionStorageInfo::UpdateFilesByCompactionPri(
     const ImmutableOptions& ioptions, const MutableCFOptions& options) {
   if (compaction_style_ == kCompactionStyleNone ||
       compaction_style_ == kCompactionStyleFIFO ||
-      compaction_style_ == kCompactionStyleUniversal) {
+      compaction_style_ == kCompactionStyleUniversal ||
+      compaction_style_ == kCompactionStyleHybrid) {
     // don't need this
     return;
   }
@@ -4717,7 +4908,8 @@ void VersionStorageInfo::CalculateBaseBytes(const ImmutableOptions& ioptions,
   // Special logic to set number of sorted runs.
   // It is to match the previous behavior when all files are in L0.
   int num_l0_count = static_cast<int>(files_[0].size());
-  if (compaction_style_ == kCompactionStyleUniversal) {
+  if (compaction_style_ == kCompactionStyleUniversal ||
+      compaction_style_ == kCompactionStyleHybrid) {
     // For universal compaction, we use level0 score to indicate
     // compaction score for the whole DB. Adding other levels as if
     // they are L0 files.
@@ -4957,6 +5149,7 @@ Env::WriteLifeTimeHint VersionStorageInfo::CalculateSSTWriteHint(
       return static_cast<Env::WriteLifeTimeHint>(
           level - base_level_ + static_cast<int>(Env::WLTH_MEDIUM));
     case kCompactionStyleUniversal:
+    case kCompactionStyleHybrid:
       if (level == 0) {
         return Env::WLTH_SHORT;
       }
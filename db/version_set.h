@@ -242,6 +242,16 @@ class VersionStorageInfo {
       double blob_garbage_collection_force_threshold,
       bool enable_blob_garbage_collection);
 
+  // This computes blob_files_marked_for_gc_, i.e. the blob files whose own
+  // garbage ratio has reached blob_garbage_collection_file_threshold, and adds
+  // the SSTs linked to them to files_marked_for_forced_blob_gc_. It is called
+  // by ComputeCompactionScore() after ComputeFilesMarkedForForcedBlobGC().
+  //
+  // REQUIRES: DB mutex held
+  void ComputeBlobFilesMarkedForGarbageCollection(
+      double blob_garbage_collection_file_threshold,
+      bool enable_blob_garbage_collection);
+
   bool level0_non_overlapping() const { return level0_non_overlapping_; }
 
   // Updates the oldest snapshot and related internal state, like the bottommost
@@ -520,6 +530,15 @@ class VersionStorageInfo {
     return files_marked_for_forced_blob_gc_;
   }
 
+  // Blob file numbers (sorted ascending) selected for garbage collection based
+  // on their individual garbage ratio.
+  // REQUIRES: ComputeCompactionScore has been called
+  // REQUIRES: DB mutex held during access
+  const std::vector<uint64_t>& BlobFilesMarkedForGarbageCollection() const {
+    assert(finalized_);
+    return blob_files_marked_for_gc_;
+  }
+
   int base_level() const { return base_level_; }
   double level_multiplier() const { return level_multiplier_; }
 
@@ -725,6 +744,7 @@ class VersionStorageInfo {
       bottommost_files_marked_for_compaction_;
 
   autovector<std::pair<int, FileMetaData*>> files_marked_for_forced_blob_gc_;
+  std::vector<uint64_t> blob_files_marked_for_gc_;
 
   // Threshold for needing to mark another bottommost file. Maintain it so we
   // can quickly check when releasing a snapshot whether more bottommost files
@@ -1005,6 +1025,13 @@ class Version {
   Status GetPropertiesOfTablesInRange(const ReadOptions& read_options,
                                       const autovector<UserKeyRange>& ranges,
                                       TablePropertiesCollection* props) const;
+  // Loads the blocks of the internal key range [*begin, *end] of the
+  // overlapping files of all levels into the block cache. See
+  // DB::PrefetchRange().
+  Status PrefetchRange(const ReadOptions& read_options,
+                       const PrefetchRangeOptions& prefetch_options,
+                       const InternalKey* begin, const InternalKey* end) const;
+
   Status GetPropertiesOfTablesByLevel(
       const ReadOptions& read_options,
       std::vector<std::unique_ptr<TablePropertiesCollection>>* props_by_level)
@@ -1089,6 +1116,12 @@ class Version {
   // This accumulated stats will be used in compaction.
   void UpdateAccumulatedStats(const ReadOptions& read_options);
 
+  // For ReadOptions::speculative_multiget_reads: reads the data blocks that
+  // might hold the keys in range, in all the files and levels that might hold
+  // them, into the block cache with async IO, and waits for all of the reads.
+  void MultiGetSpeculativeReads(const ReadOptions& read_options,
+                                MultiGetRange* range);
+
   DECLARE_SYNC_AND_ASYNC(
       /* ret_type */ Status, /* func_name */ MultiGetFromSST,
       const ReadOptions& read_options, MultiGetRange file_range,
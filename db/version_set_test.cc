@@ -905,6 +905,88 @@ TEST_F(VersionStorageInfoTest, ForcedBlobGCMultipleBatches) {
   }
 }
 
+TEST_F(VersionStorageInfoTest, BlobGCByFileGarbageRatio) {
+  // We have two L1 SSTs #1 and #2, and three blob files #10, #11, and #12.
+  // SST #1 is linked to blob file #10 and SST #2 is linked to blob file #12.
+  // Blob file #10 has little garbage, while blob files #11 and #12 are mostly
+  // garbage. Selection by per-file garbage ratio should pick #11 and #12
+  // regardless of their age, and mark only SST #2 for compaction.
+
+  constexpr int level = 1;
+
+  constexpr uint64_t first_sst = 1;
+  constexpr uint64_t second_sst = 2;
+
+  constexpr uint64_t first_blob = 10;
+  constexpr uint64_t second_blob = 11;
+  constexpr uint64_t third_blob = 12;
+
+  Add(level, first_sst, "bar1", "bar2", /*file_size=*/1000, first_blob);
+  Add(level, second_sst, "foo1", "foo2", /*file_size=*/1000, third_blob);
+
+  AddBlob(first_blob, /*total_blob_count=*/10, /*total_blob_bytes=*/100000,
+          BlobFileMetaData::LinkedSsts{first_sst}, /*garbage_blob_count=*/1,
+          /*garbage_blob_bytes=*/10000);
+  AddBlob(second_blob, /*total_blob_count=*/10, /*total_blob_bytes=*/100000,
+          BlobFileMetaData::LinkedSsts{}, /*garbage_blob_count=*/9,
+          /*garbage_blob_bytes=*/90000);
+  AddBlob(third_blob, /*total_blob_count=*/10, /*total_blob_bytes=*/100000,
+          BlobFileMetaData::LinkedSsts{second_sst}, /*garbage_blob_count=*/8,
+          /*garbage_blob_bytes=*/80000);
+
+  UpdateVersionStorageInfo();
+
+  const auto& level_files = vstorage_.LevelFiles(level);
+  assert(level_files.size() == 2);
+  assert(level_files[1] && level_files[1]->fd.GetNumber() == second_sst);
+
+  // Disabled
+
+  {
+    vstorage_.ComputeBlobFilesMarkedForGarbageCollection(
+        /*blob_garbage_collection_file_threshold=*/0.5,
+        /*enable_blob_garbage_collection=*/false);
+
+    ASSERT_TRUE(vstorage_.BlobFilesMarkedForGarbageCollection().empty());
+  }
+
+  // No blob file meets the threshold
+
+  {
+    vstorage_.ComputeFilesMarkedForForcedBlobGC(
+        /*blob_garbage_collection_age_cutoff=*/0.25,
+        /*blob_garbage_collection_force_threshold=*/1.0,
+        /*enable_blob_garbage_collection=*/true);
+    vstorage_.ComputeBlobFilesMarkedForGarbageCollection(
+        /*blob_garbage_collection_file_threshold=*/0.95,
+        /*enable_blob_garbage_collection=*/true);
+
+    ASSERT_TRUE(vstorage_.BlobFilesMarkedForGarbageCollection().empty());
+    ASSERT_TRUE(vstorage_.FilesMarkedForForcedBlobGC().empty());
+  }
+
+  // Blob files #11 and #12 meet the threshold
+
+  {
+    vstorage_.ComputeFilesMarkedForForcedBlobGC(
+        /*blob_garbage_collection_age_cutoff=*/0.25,
+        /*blob_garbage_collection_force_threshold=*/1.0,
+        /*enable_blob_garbage_collection=*/true);
+    vstorage_.ComputeBlobFilesMarkedForGarbageCollection(
+        /*blob_garbage_collection_file_threshold=*/0.75,
+        /*enable_blob_garbage_collection=*/true);
+
+    const std::vector<uint64_t> expected_blob_files{second_blob, third_blob};
+    ASSERT_EQ(vstorage_.BlobFilesMarkedForGarbageCollection(),
+              expected_blob_files);
+
+    const auto& ssts_to_be_compacted = vstorage_.FilesMarkedForForcedBlobGC();
+    ASSERT_EQ(ssts_to_be_compacted.size(), 1);
+    ASSERT_EQ(ssts_to_be_compacted[0],
+              (std::pair<int, FileMetaData*>(level, level_files[1])));
+  }
+}
+
 class VersionStorageInfoTimestampTest : public VersionStorageInfoTestBase {
  public:
   VersionStorageInfoTimestampTest()
@@ -1988,6 +1988,7 @@ class MemTableInserter : public WriteBatch::Handler {
   // log number that all Memtables inserted into should reference
   uint64_t log_number_ref_;
   DBImpl* db_;
+  NegativeLookupCache* const negative_lookup_cache_;
   const bool concurrent_memtable_writes_;
   bool post_info_created_;
   const WriteBatch::ProtectionInfo* prot_info_;
@@ -2104,6 +2105,8 @@ class MemTableInserter : public WriteBatch::Handler {
         recovering_log_number_(recovering_log_number),
         log_number_ref_(0),
         db_(static_cast_with_check<DBImpl>(db)),
+        negative_lookup_cache_(db_ != nullptr ? db_->negative_lookup_cache()
+                                              : nullptr),
         concurrent_memtable_writes_(concurrent_memtable_writes),
         post_info_created_(false),
         prot_info_(prot_info),
@@ -2163,6 +2166,14 @@ class MemTableInserter : public WriteBatch::Handler {
     }
   }
 
+  // Called for every key that may have become visible, before the sequence
+  // number is advanced past it
+  void NotifyNegativeLookupCache(uint32_t column_family_id, const Slice& key) {
+    if (negative_lookup_cache_ != nullptr) {
+      negative_lookup_cache_->OnWrite(column_family_id, key, sequence_);
+    }
+  }
+
   void set_log_number_ref(uint64_t log) { log_number_ref_ = log; }
   void set_prot_info(const WriteBatch::ProtectionInfo* prot_info) {
     prot_info_ = prot_info;
@@ -2361,6 +2372,7 @@ class MemTableInserter : public WriteBatch::Handler {
       const bool kBatchBoundary = true;
       MaybeAdvanceSeq(kBatchBoundary);
     } else if (ret_status.ok()) {
+      NotifyNegativeLookupCache(column_family_id, key);
       MaybeAdvanceSeq();
       CheckMemtableFull();
     }
@@ -2883,6 +2895,7 @@ class MemTableInserter : public WriteBatch::Handler {
       const bool kBatchBoundary = true;
       MaybeAdvanceSeq(kBatchBoundary);
     } else if (ret_status.ok()) {
+      NotifyNegativeLookupCache(column_family_id, key);
       MaybeAdvanceSeq();
       CheckMemtableFull();
     }
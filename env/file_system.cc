@@ -160,6 +160,8 @@ FileOptions FileSystem::OptimizeForCompactionTableWrite(
   FileOptions optimized_file_options(file_options);
   optimized_file_options.use_direct_writes =
       db_options.use_direct_io_for_flush_and_compaction;
+  optimized_file_options.writable_file_num_buffers =
+      db_options.flush_and_compaction_write_num_buffers;
   return optimized_file_options;
 }
 
@@ -352,7 +352,12 @@ class PosixFileSystem : public FileSystem {
 #endif
       result->reset(new PosixWritableFile(
           fname, fd, GetLogicalBlockSizeForWriteIfNeeded(options, fname, fd),
-          options, initial_file_size));
+          options, initial_file_size
+#if defined(ROCKSDB_IOURING_PRESENT)
+          ,
+          !IsIOUringEnabled() ? nullptr : thread_local_io_urings_.get()
+#endif
+              ));
     } else {
       // disable mmap writes
       EnvOptions no_mmap_writes_options = options;
@@ -448,7 +453,12 @@ class PosixFileSystem : public FileSystem {
 #endif
       result->reset(new PosixWritableFile(
           fname, fd, GetLogicalBlockSizeForWriteIfNeeded(options, fname, fd),
-          options, /*initial_file_size=*/0));
+          options, /*initial_file_size=*/0
+#if defined(ROCKSDB_IOURING_PRESENT)
+          ,
+          !IsIOUringEnabled() ? nullptr : thread_local_io_urings_.get()
+#endif
+              ));
     } else {
       // disable mmap writes
       FileOptions no_mmap_writes_options = options;
@@ -1108,25 +1118,33 @@ class PosixFileSystem : public FileSystem {
         // Reset cqe data to catch any stray reuse of it
         static_cast<struct io_uring_cqe*>(cqe)->user_data = 0xd5d5d5d5d5d5d5d5;
 
-        FSReadRequest req;
-        req.scratch = posix_handle->scratch;
-        req.offset = posix_handle->offset;
-        req.len = posix_handle->len;
-
-        size_t finished_len = 0;
-        size_t bytes_read = 0;
-        bool read_again = false;
-        UpdateResult(cqe, "", req.len, posix_handle->iov.iov_len,
-                     true /*async_read*/, posix_handle->use_direct_io,
-                     posix_handle->alignment, finished_len, &req, bytes_read,
-                     read_again);
-        posix_handle->is_finished = true;
-        io_uring_cqe_seen(iu, cqe);
-        posix_handle->cb(req, posix_handle->cb_arg);
+        if (posix_handle->write_cb) {
+          // PositionedAppendAsync() request
+          const int res = cqe->res;
+          posix_handle->is_finished = true;
+          io_uring_cqe_seen(iu, cqe);
+          posix_handle->write_cb(res);
+        } else {
+          FSReadRequest req;
+          req.scratch = posix_handle->scratch;
+          req.offset = posix_handle->offset;
+          req.len = posix_handle->len;
+
+          size_t finished_len = 0;
+          size_t bytes_read = 0;
+          bool read_again = false;
+          UpdateResult(cqe, "", req.len, posix_handle->iov.iov_len,
+                       true /*async_read*/, posix_handle->use_direct_io,
+                       posix_handle->alignment, finished_len, &req,
+                       bytes_read, read_again);
+          posix_handle->is_finished = true;
+          io_uring_cqe_seen(iu, cqe);
+          posix_handle->cb(req, posix_handle->cb_arg);
 
-        (void)finished_len;
-        (void)bytes_read;
-        (void)read_again;
+          (void)finished_len;
+          (void)bytes_read;
+          (void)read_again;
+        }
 
         if (static_cast<Posix_IOHandle*>(io_handles[i]) == posix_handle) {
           break;
@@ -1228,9 +1246,13 @@ class PosixFileSystem : public FileSystem {
         if (posix_handle->req_count == 2 &&
             static_cast<Posix_IOHandle*>(io_handles[i]) == posix_handle) {
           posix_handle->is_finished = true;
-          FSReadRequest req;
-          req.status = IOStatus::Aborted();
-          posix_handle->cb(req, posix_handle->cb_arg);
+          if (posix_handle->write_cb) {
+            posix_handle->write_cb(-ECANCELED);
+          } else {
+            FSReadRequest req;
+            req.status = IOStatus::Aborted();
+            posix_handle->cb(req, posix_handle->cb_arg);
+          }
 
           break;
         }
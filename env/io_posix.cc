@@ -1319,13 +1319,23 @@ IOStatus PosixMmapFile::Allocate(uint64_t offset, uint64_t len,
 PosixWritableFile::PosixWritableFile(const std::string& fname, int fd,
                                      size_t logical_block_size,
                                      const EnvOptions& options,
-                                     uint64_t initial_file_size)
+                                     uint64_t initial_file_size
+#if defined(ROCKSDB_IOURING_PRESENT)
+                                     ,
+                                     ThreadLocalPtr* thread_local_io_urings
+#endif
+                                     )
     : FSWritableFile(options),
       filename_(fname),
       use_direct_io_(options.use_direct_writes),
       fd_(fd),
       filesize_(initial_file_size),
-      logical_sector_size_(logical_block_size) {
+      logical_sector_size_(logical_block_size)
+#if defined(ROCKSDB_IOURING_PRESENT)
+      ,
+      thread_local_io_urings_(thread_local_io_urings)
+#endif
+{
 #ifdef ROCKSDB_FALLOCATE_PRESENT
   allow_fallocate_ = options.allow_fallocate;
   fallocate_with_keep_size_ = options.fallocate_with_keep_size;
@@ -1379,6 +1389,96 @@ IOStatus PosixWritableFile::PositionedAppend(const Slice& data, uint64_t offset,
   return IOStatus::OK();
 }
 
+IOStatus PosixWritableFile::PositionedAppendAsync(
+    const Slice& data, uint64_t offset, const IOOptions& /*opts*/,
+    std::function<void(const IOStatus&, void*)> cb, void* cb_arg,
+    void** io_handle, IOHandleDeleter* del_fn, IODebugContext* /*dbg*/) {
+  if (use_direct_io()) {
+    assert(IsSectorAligned(offset, GetRequiredBufferAlignment()));
+    assert(IsSectorAligned(data.size(), GetRequiredBufferAlignment()));
+    assert(IsSectorAligned(data.data(), GetRequiredBufferAlignment()));
+  }
+  assert(offset <= static_cast<uint64_t>(std::numeric_limits<off_t>::max()));
+
+#if defined(ROCKSDB_IOURING_PRESENT)
+  struct io_uring* iu = nullptr;
+  if (thread_local_io_urings_) {
+    iu = static_cast<struct io_uring*>(thread_local_io_urings_->Get());
+    if (iu == nullptr) {
+      iu = CreateIOUring();
+      if (iu != nullptr) {
+        thread_local_io_urings_->Reset(iu);
+      }
+    }
+  }
+
+  // Init failed, platform doesn't support io_uring.
+  if (iu == nullptr) {
+    return IOStatus::NotSupported("PositionedAppendAsync");
+  }
+
+  IOHandleDeleter deletefn = [](void* args) -> void {
+    delete (static_cast<Posix_IOHandle*>(args));
+    args = nullptr;
+  };
+
+  char* buf = const_cast<char*>(data.data());
+  Posix_IOHandle* posix_handle =
+      new Posix_IOHandle(iu, /*_cb=*/nullptr, cb_arg, offset, data.size(), buf,
+                         use_direct_io(), GetRequiredBufferAlignment());
+  posix_handle->iov.iov_base = buf;
+  posix_handle->iov.iov_len = data.size();
+  // The file outlives its writes in flight, see
+  // FSWritableFile::PositionedAppendAsync().
+  posix_handle->write_cb = [this, cb, cb_arg, data, offset](int res) {
+    IOStatus s;
+    if (res < 0) {
+      s = IOError("While async pwrite to file at offset " +
+                      std::to_string(offset),
+                  filename_, -res);
+    } else if (static_cast<size_t>(res) < data.size()) {
+      // Finish a short write synchronously
+      const size_t written = static_cast<size_t>(res);
+      if (!PosixPositionedWrite(fd_, data.data() + written,
+                                data.size() - written,
+                                static_cast<off_t>(offset + written))) {
+        s = IOError("While pwrite to file at offset " +
+                        std::to_string(offset + written),
+                    filename_, errno);
+      }
+    }
+    cb(s, cb_arg);
+  };
+
+  *io_handle = static_cast<void*>(posix_handle);
+  *del_fn = deletefn;
+
+  struct io_uring_sqe* sqe;
+  sqe = io_uring_get_sqe(iu);
+  io_uring_prep_writev(sqe, fd_, /*sqe->addr=*/&posix_handle->iov,
+                       /*sqe->len=*/1, /*sqe->offset=*/offset);
+  // Sets sqe->user_data to posix_handle.
+  io_uring_sqe_set_data(sqe, posix_handle);
+
+  ssize_t ret = io_uring_submit(iu);
+  if (ret < 0) {
+    fprintf(stderr, "io_uring_submit error: %ld\n", long(ret));
+    return IOStatus::IOError("io_uring_submit() requested but returned " +
+                             std::to_string(ret));
+  }
+  filesize_ = offset + data.size();
+  return IOStatus::OK();
+#else
+  (void)data;
+  (void)offset;
+  (void)cb;
+  (void)cb_arg;
+  (void)io_handle;
+  (void)del_fn;
+  return IOStatus::NotSupported("PositionedAppendAsync");
+#endif
+}
+
 IOStatus PosixWritableFile::Truncate(uint64_t size, const IOOptions& /*opts*/,
                                      IODebugContext* /*dbg*/) {
   IOStatus s;
@@ -131,6 +131,9 @@ struct Posix_IOHandle {
   bool is_finished;
   // req_count is used by AbortIO API to keep track of number of requests.
   uint32_t req_count;
+  // Only set for PosixWritableFile::PositionedAppendAsync() requests, which
+  // are completed with the io_uring result through it instead of `cb`.
+  std::function<void(int)> write_cb;
 };
 
 inline void UpdateResult(struct io_uring_cqe* cqe, const std::string& file_name,
@@ -370,12 +373,20 @@ class PosixWritableFile : public FSWritableFile {
   // support it, so we need to do a dynamic check too.
   bool sync_file_range_supported_;
 #endif  // ROCKSDB_RANGESYNC_PRESENT
+#if defined(ROCKSDB_IOURING_PRESENT)
+  ThreadLocalPtr* thread_local_io_urings_;
+#endif
 
  public:
   explicit PosixWritableFile(const std::string& fname, int fd,
                              size_t logical_block_size,
                              const EnvOptions& options,
-                             uint64_t initial_file_size);
+                             uint64_t initial_file_size
+#if defined(ROCKSDB_IOURING_PRESENT)
+                             ,
+                             ThreadLocalPtr* thread_local_io_urings = nullptr
+#endif
+  );
   virtual ~PosixWritableFile();
 
   // Need to implement this so the file is truncated correctly
@@ -399,6 +410,10 @@ class PosixWritableFile : public FSWritableFile {
                             IODebugContext* dbg) override {
     return PositionedAppend(data, offset, opts, dbg);
   }
+  IOStatus PositionedAppendAsync(
+      const Slice& data, uint64_t offset, const IOOptions& opts,
+      std::function<void(const IOStatus&, void*)> cb, void* cb_arg,
+      void** io_handle, IOHandleDeleter* del_fn, IODebugContext* dbg) override;
   IOStatus Flush(const IOOptions& opts, IODebugContext* dbg) override;
   IOStatus Sync(const IOOptions& opts, IODebugContext* dbg) override;
   IOStatus Fsync(const IOOptions& opts, IODebugContext* dbg) override;
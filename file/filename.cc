@@ -253,6 +253,10 @@ std::string IdentityFileName(const std::string& dbname) {
   return dbname + "/IDENTITY";
 }
 
+std::string BlockCacheManifestFileName(const std::string& dbname) {
+  return dbname + "/BLOCK_CACHE_MANIFEST";
+}
+
 // Owned filenames have the form:
 //    dbname/IDENTITY
 //    dbname/CURRENT
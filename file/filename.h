@@ -144,6 +144,10 @@ std::string MetaDatabaseName(const std::string& dbname, uint64_t number);
 // either from a backup-image or empty
 std::string IdentityFileName(const std::string& dbname);
 
+// Return the name of the file listing the blocks to reload into the block
+// cache on DB open. See DBOptions::block_cache_manifest_period_sec.
+std::string BlockCacheManifestFileName(const std::string& dbname);
+
 // If filename is a rocksdb file, store the type of the file in *type.
 // The number encoded in the filename is stored in *number.  If the
 // filename was successfully parsed, returns true.  Else return false.
@@ -393,6 +393,70 @@ TEST_P(PrefetchTest, Basic) {
   Close();
 }
 
+TEST_P(PrefetchTest, CompactionReadaheadMultipleBuffers) {
+  // First param is if the mockFS support_prefetch or not
+  bool support_prefetch =
+      std::get<0>(GetParam()) &&
+      test::IsPrefetchSupported(env_->GetFileSystem(), dbname_);
+  std::shared_ptr<MockFS> fs =
+      std::make_shared<MockFS>(env_->GetFileSystem(), support_prefetch);
+
+  // Second param is if directIO is enabled or not
+  bool use_direct_io = std::get<1>(GetParam());
+
+  std::unique_ptr<Env> env(new CompositeEnvWrapper(env_, fs));
+  Options options;
+  SetGenericOptions(env.get(), use_direct_io, options);
+  options.compaction_readahead_size = 16 * 1024;
+  options.compaction_readahead_num_buffers = 2;
+
+  const int kNumKeys = 1100;
+  int buff_async_prefetch_count = 0;
+  SyncPoint::GetInstance()->SetCallBack(
+      "FilePrefetchBuffer::ReadAsync",
+      [&](void*) { buff_async_prefetch_count++; });
+  SyncPoint::GetInstance()->EnableProcessing();
+
+  Status s = TryReopen(options);
+  if (use_direct_io && (s.IsNotSupported() || s.IsInvalidArgument())) {
+    // If direct IO is not supported, skip the test
+    return;
+  } else {
+    ASSERT_OK(s);
+  }
+
+  for (int round = 0; round < 2; round++) {
+    WriteBatch batch;
+    for (int i = 0; i < kNumKeys; i++) {
+      ASSERT_OK(batch.Put(BuildKey(i), "v" + std::to_string(round)));
+    }
+    ASSERT_OK(db_->Write(WriteOptions(), &batch));
+    ASSERT_OK(db_->Flush(FlushOptions()));
+  }
+
+  fs->ClearPrefetchCount();
+  ASSERT_OK(db_->CompactRange(CompactRangeOptions(), nullptr, nullptr));
+
+  // The FileSystem Prefetch() is bypassed and the second half of each
+  // readahead is submitted asynchronously.
+  ASSERT_FALSE(fs->IsPrefetchCalled());
+  ASSERT_GT(buff_async_prefetch_count, 0);
+
+  auto iter = std::unique_ptr<Iterator>(db_->NewIterator(ReadOptions()));
+  int num_keys = 0;
+  for (iter->SeekToFirst(); iter->Valid(); iter->Next()) {
+    ASSERT_EQ(iter->value(), "v1");
+    num_keys++;
+  }
+  ASSERT_OK(iter->status());
+  ASSERT_EQ(num_keys, kNumKeys);
+  iter.reset();
+
+  SyncPoint::GetInstance()->DisableProcessing();
+  SyncPoint::GetInstance()->ClearAllCallBacks();
+  Close();
+}
+
 class PrefetchTailTest : public PrefetchTest {
  public:
   bool SupportPrefetch() const {
@@ -176,7 +176,11 @@ IOStatus WritableFileWriter::Append(const IOOptions& opts, const Slice& data,
         src += appended;
 
         if (left > 0) {
-          s = Flush(io_options);
+          if (max_async_writes_ > 0) {
+            s = WriteDirectAsync(io_options);
+          } else {
+            s = Flush(io_options);
+          }
           if (!s.ok()) {
             break;
           }
@@ -249,6 +253,9 @@ IOStatus WritableFileWriter::Pad(const IOOptions& opts,
 
 IOStatus WritableFileWriter::Close(const IOOptions& opts) {
   IOOptions io_options = FinalizeIOOptions(opts);
+  // Asynchronous writes in flight reference our buffers and the file, so they
+  // are reaped first. A failure is surfaced through seen_error().
+  WaitForAsyncWrites(0).PermitUncheckedError();
   if (seen_error()) {
     IOStatus interim;
     if (writable_file_.get() != nullptr) {
@@ -364,6 +371,13 @@ IOStatus WritableFileWriter::Flush(const IOOptions& opts) {
   IOStatus s;
   TEST_KILL_RANDOM_WITH_WEIGHT("WritableFileWriter::Flush:0", REDUCE_ODDS2);
 
+  if (!async_writes_.empty()) {
+    s = WaitForAsyncWrites(0);
+    if (!s.ok()) {
+      return s;
+    }
+  }
+
   if (buf_.CurrentSize() > 0) {
     if (use_direct_io()) {
       if (pending_sync_) {
@@ -987,6 +1001,157 @@ IOStatus WritableFileWriter::WriteDirectWithChecksum(const IOOptions& opts) {
   }
   return s;
 }
+
+IOStatus WritableFileWriter::WriteDirectAsync(const IOOptions& opts) {
+  if (seen_error()) {
+    return GetWriterHasPreviousErrorStatus();
+  }
+
+  assert(use_direct_io());
+  assert(max_async_writes_ > 0);
+  const size_t alignment = buf_.Alignment();
+  assert((next_write_offset_ % alignment) == 0);
+
+  // Only whole pages are submitted. The leftover tail is carried over to the
+  // next buffer and written once its page fills up.
+  const size_t file_advance =
+      TruncateToPageBoundary(alignment, buf_.CurrentSize());
+  if (file_advance == 0) {
+    return Flush(opts);
+  }
+  const size_t leftover_tail = buf_.CurrentSize() - file_advance;
+
+  // Keep at most max_async_writes_ writes in flight
+  IOStatus s = WaitForAsyncWrites(max_async_writes_ - 1);
+  if (!s.ok()) {
+    return s;
+  }
+
+  Env::IOPriority rate_limiter_priority_used = opts.rate_limiter_priority;
+  if (rate_limiter_ != nullptr && rate_limiter_priority_used != Env::IO_TOTAL) {
+    size_t data_size = file_advance;
+    while (data_size > 0) {
+      data_size -= rate_limiter_->RequestToken(
+          data_size, alignment, rate_limiter_priority_used, stats_,
+          RateLimiter::OpType::kWrite);
+    }
+  }
+
+  AlignedBuffer next_buf;
+  if (!spare_write_buffers_.empty()) {
+    next_buf = std::move(spare_write_buffers_.back());
+    spare_write_buffers_.pop_back();
+  }
+  if (next_buf.Capacity() < buf_.Capacity()) {
+    next_buf.Alignment(alignment);
+    next_buf.AllocateNewBuffer(buf_.Capacity());
+  }
+  next_buf.Clear();
+  next_buf.Append(buf_.BufferStart() + file_advance, leftover_tail);
+
+  std::unique_ptr<AsyncWrite> write(new AsyncWrite());
+  write->buf = std::move(buf_);
+  write->buf.Size(file_advance);
+  write->offset = next_write_offset_;
+  buf_ = std::move(next_buf);
+  AsyncWrite* const w = write.get();
+  async_writes_.push_back(std::move(write));
+
+  {
+    IOSTATS_TIMER_GUARD(write_nanos);
+    TEST_SYNC_POINT("WritableFileWriter::WriteDirectAsync:BeforeSubmit");
+    if (ShouldNotifyListeners()) {
+      w->start_ts = FileOperationInfo::StartNow();
+    }
+    const Slice data(w->buf.BufferStart(), file_advance);
+    s = writable_file_->PositionedAppendAsync(
+        data, w->offset, opts,
+        [this](const IOStatus& status, void* cb_arg) {
+          AsyncWrite* completed_write = static_cast<AsyncWrite*>(cb_arg);
+          if (ShouldNotifyListeners()) {
+            completed_write->finish_ts = FileOperationInfo::FinishNow();
+          }
+          completed_write->status = status;
+          completed_write->completed = true;
+        },
+        w, &w->io_handle, &w->del_fn, nullptr);
+    if (s.IsNotSupported()) {
+      // The FileSystem cannot write asynchronously after all. Write this
+      // buffer synchronously and stay on the synchronous path from now on.
+      max_async_writes_ = 0;
+      s = writable_file_->PositionedAppend(data, w->offset, opts, nullptr);
+      if (ShouldNotifyListeners()) {
+        w->finish_ts = FileOperationInfo::FinishNow();
+      }
+      w->status = s;
+      w->completed = true;
+    } else if (!s.ok()) {
+      // Nothing was submitted
+      w->status = s;
+      w->completed = true;
+    }
+  }
+
+  if (!s.ok()) {
+    set_seen_error(s);
+    return s;
+  }
+  IOSTATS_ADD(bytes_written, file_advance);
+  next_write_offset_ += file_advance;
+  return s;
+}
+
+IOStatus WritableFileWriter::WaitForAsyncWrites(size_t max_pending) {
+  IOStatus s;
+  while (async_writes_.size() > max_pending) {
+    AsyncWrite* w = async_writes_.front().get();
+    if (!w->completed) {
+      assert(fs_ != nullptr);
+      std::vector<void*> io_handles{w->io_handle};
+      IOStatus poll_s = fs_->Poll(io_handles, 1);
+      if (!w->completed) {
+        // The buffer must not be released while the write may still be in
+        // flight.
+        fs_->AbortIO(io_handles).PermitUncheckedError();
+        w->status = poll_s.ok() ? IOStatus::IOError(
+                                      "Asynchronous write did not complete")
+                                : poll_s;
+      } else {
+        poll_s.PermitUncheckedError();
+      }
+    }
+    if (w->io_handle != nullptr && w->del_fn != nullptr) {
+      w->del_fn(w->io_handle);
+      w->io_handle = nullptr;
+    }
+
+    const size_t size = w->buf.CurrentSize();
+    if (ShouldNotifyListeners()) {
+      NotifyOnFileWriteFinish(w->offset, size, w->start_ts, w->finish_ts,
+                              w->status);
+      if (!w->status.ok()) {
+        NotifyOnIOError(w->status, FileOperationType::kPositionedAppend,
+                        file_name(), size, w->offset);
+      }
+    }
+    if (w->status.ok()) {
+      uint64_t cur_size = flushed_size_.load(std::memory_order_acquire);
+      flushed_size_.store(cur_size + size, std::memory_order_release);
+    } else if (s.ok()) {
+      s = w->status;
+    }
+
+    w->buf.Clear();
+    spare_write_buffers_.push_back(std::move(w->buf));
+    async_writes_.pop_front();
+  }
+
+  if (!s.ok()) {
+    set_seen_error(s);
+  }
+  return s;
+}
+
 Env::IOPriority WritableFileWriter::DecideRateLimiterPriority(
     Env::IOPriority writable_file_io_priority,
     Env::IOPriority op_rate_limiter_priority) {
@@ -9,7 +9,10 @@
 
 #pragma once
 #include <atomic>
+#include <deque>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "db/version_edit.h"
 #include "env/file_system_tracer.h"
@@ -168,6 +171,28 @@ class WritableFileWriter {
   bool buffered_data_with_checksum_;
   Temperature temperature_;
 
+  // A whole-page prefix of the write buffer submitted through
+  // FSWritableFile::PositionedAppendAsync().
+  struct AsyncWrite {
+    AlignedBuffer buf;
+    uint64_t offset = 0;
+    void* io_handle = nullptr;
+    IOHandleDeleter del_fn;
+    bool completed = false;
+    IOStatus status;
+    FileOperationInfo::StartTimePoint start_ts;
+    FileOperationInfo::FinishTimePoint finish_ts;
+  };
+  // Used to poll for the completion of asynchronous writes.
+  FileSystem* fs_;
+  // Maximum number of asynchronous writes in flight. 0 unless direct I/O is
+  // used with FileOptions::writable_file_num_buffers > 1.
+  size_t max_async_writes_;
+  // Submitted asynchronous writes that have not been reaped, oldest first.
+  std::deque<std::unique_ptr<AsyncWrite>> async_writes_;
+  // Buffers of reaped asynchronous writes, reused for later submissions.
+  std::vector<AlignedBuffer> spare_write_buffers_;
+
  public:
   WritableFileWriter(
       std::unique_ptr<FSWritableFile>&& file, const std::string& _file_name,
@@ -178,7 +203,7 @@ class WritableFileWriter {
       const std::vector<std::shared_ptr<EventListener>>& listeners = {},
       FileChecksumGenFactory* file_checksum_gen_factory = nullptr,
       bool perform_data_verification = false,
-      bool buffered_data_with_checksum = false)
+      bool buffered_data_with_checksum = false, FileSystem* fs = nullptr)
       : file_name_(_file_name),
         writable_file_(std::move(file), io_tracer, _file_name),
         clock_(clock),
@@ -202,9 +227,17 @@ class WritableFileWriter {
         checksum_finalized_(false),
         perform_data_verification_(perform_data_verification),
         buffered_data_crc32c_checksum_(0),
-        buffered_data_with_checksum_(buffered_data_with_checksum) {
+        buffered_data_with_checksum_(buffered_data_with_checksum),
+        fs_(fs),
+        max_async_writes_(0) {
     temperature_ = options.temperature;
     assert(!use_direct_io() || max_buffer_size_ > 0);
+    // Async writes carry no DataVerificationInfo, so checksum handoff keeps
+    // the synchronous path.
+    if (fs_ != nullptr && use_direct_io() && !perform_data_verification_ &&
+        options.writable_file_num_buffers > 1) {
+      max_async_writes_ = options.writable_file_num_buffers - 1;
+    }
     TEST_SYNC_POINT_CALLBACK("WritableFileWriter::WritableFileWriter:0",
                              reinterpret_cast<void*>(max_buffer_size_));
     buf_.Alignment(writable_file_->GetRequiredBufferAlignment());
@@ -355,6 +388,15 @@ class WritableFileWriter {
   IOStatus WriteDirect(const IOOptions& opts);
   // `opts` should've been called with `FinalizeIOOptions()` before passing in
   IOStatus WriteDirectWithChecksum(const IOOptions& opts);
+  // Used in place of WriteDirect() when the buffer fills up during Append()
+  // and async writes are enabled. Submits the whole pages of the buffer with
+  // PositionedAppendAsync() and continues in a spare buffer holding the
+  // leftover tail, so no two writes in flight ever cover the same page.
+  // `opts` should've been called with `FinalizeIOOptions()` before passing in
+  IOStatus WriteDirectAsync(const IOOptions& opts);
+  // Reaps asynchronous writes, oldest first, until no more than `max_pending`
+  // remain in flight.
+  IOStatus WaitForAsyncWrites(size_t max_pending);
   // Normal write.
   // `opts` should've been called with `FinalizeIOOptions()` before passing in
   IOStatus WriteBuffered(const IOOptions& opts, const char* data, size_t size);
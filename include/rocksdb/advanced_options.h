@@ -33,6 +33,11 @@ enum CompactionStyle : char {
   // Disable background compaction. Compaction jobs are submitted
   // via CompactFiles().
   kCompactionStyleNone = 0x3,
+  // EXPERIMENTAL
+  // Hybrid tiered-leveled compaction style. Upper levels are tiered (they
+  // may hold several sorted runs of similar size) and the last one or two
+  // levels are leveled. See CompactionOptionsHybrid.
+  kCompactionStyleHybrid = 0x4,
 };
 
 // In Level-based compaction, it Determines which file from a level to be
@@ -140,6 +145,38 @@ struct CompactionOptionsFIFO {
 #endif
 };
 
+// EXPERIMENTAL
+// Options for kCompactionStyleHybrid. The LSM-tree uses the same layout as
+// universal compaction: every L0 file and every non-empty level is one
+// sorted run. Levels below `num_levels - num_leveled_levels` hold the tiered
+// runs, the remaining levels are leveled. A tiered run belongs to tier `t`
+// when its size is within [write_buffer_size * size_ratio^t,
+// write_buffer_size * size_ratio^(t+1)). Adjacent runs of the same tier are
+// merged together once there are enough of them, and the oldest tiered run
+// is merged into the first leveled level once it is at least
+// 1/size_ratio of that level's size.
+struct CompactionOptionsHybrid {
+  // Size ratio between adjacent tiers, and between the two leveled levels
+  // when `num_leveled_levels` is 2. Must be at least 2.
+  // Default: 10
+  int size_ratio = 10;
+
+  // Number of sorted runs tier `t` may hold before they are merged into a
+  // single run. Tiers beyond the end of the vector, or an entry that is not
+  // positive, use `size_ratio`.
+  // Default: empty
+  std::vector<int> max_runs_per_tier{};
+
+  // Number of levels at the bottom of the LSM-tree that are leveled. Must be
+  // 1 or 2, and `num_levels` must be at least `num_leveled_levels + 2`.
+  // Default: 1
+  int num_leveled_levels = 1;
+
+#if __cplusplus >= 202002L
+  bool operator==(const CompactionOptionsHybrid& rhs) const = default;
+#endif
+};
+
 // The control option of how the cache tiers will be used. Currently rocksdb
 // support block cache (volatile tier), secondary cache (non-volatile tier).
 // In the future, we may add more caching layers.
@@ -622,6 +659,14 @@ struct AdvancedColumnFamilyOptions {
   // SetOptions("compaction_options_fifo", "{max_table_files_size=100;}")
   CompactionOptionsFIFO compaction_options_fifo;
 
+  // EXPERIMENTAL
+  // The options for hybrid tiered-leveled compaction style
+  //
+  // Dynamically changeable through SetOptions() API
+  // Dynamic change example:
+  // SetOptions("compaction_options_hybrid", "{size_ratio=8;}")
+  CompactionOptionsHybrid compaction_options_hybrid;
+
   // An iteration->Next() sequentially skips over keys with the same
   // user-key unless this option is set. This number specifies the number
   // of keys (with the same userkey) that will be sequentially
@@ -699,6 +744,20 @@ struct AdvancedColumnFamilyOptions {
   // Default: false
   bool optimize_filters_for_hits = false;
 
+  // EXPERIMENTAL
+  // If true, point lookups find the range tombstones covering a key in the
+  // immutable memtables and SST files with a single search of one merged,
+  // fragmented list of all of them, instead of searching the tombstones of
+  // each memtable and file they look into. The list is built by the first
+  // lookup after each flush or compaction, which opens every SST file, so
+  // this only pays off with many live range tombstones. Only used with the
+  // bytewise comparator and without user-defined timestamps.
+  //
+  // Default: false
+  //
+  // Dynamically changeable through SetOptions() API
+  bool range_tombstone_index_for_point_lookups = false;
+
   // After writing every SST file, reopen it and read all the keys.
   // Checks the hash of all of the keys and values written versus the
   // keys in the file and signals a corruption if they do not match
@@ -968,6 +1027,23 @@ struct AdvancedColumnFamilyOptions {
   // Dynamically changeable through the SetOptions() API
   double blob_garbage_collection_force_threshold = 1.0;
 
+  // If the garbage ratio (garbage bytes / total bytes) of an individual blob
+  // file reaches this threshold, the blob file is selected for garbage
+  // collection regardless of its age. Live blobs in selected files are
+  // relocated by any compaction that encounters them, and targeted
+  // compactions are scheduled for the SST files linked to the selected blob
+  // files. These compactions rewrite only the affected SSTs in place (output
+  // to the same level), so blob space can be reclaimed without waiting for
+  // the age-based cutoff or rewriting unrelated SST data. This option is
+  // currently only supported with leveled compactions. Note that
+  // enable_blob_garbage_collection has to be set in order for this option to
+  // have any effect.
+  //
+  // Default: 1.0 (disabled)
+  //
+  // Dynamically changeable through the SetOptions() API
+  double blob_garbage_collection_file_threshold = 1.0;
+
   // Compaction readahead for blob files.
   //
   // Default: 0
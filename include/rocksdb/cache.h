@@ -15,6 +15,7 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "rocksdb/compression_type.h"
 #include "rocksdb/data_structure.h"
@@ -189,6 +190,22 @@ struct ShardedCacheOptions {
   //   repeatable behavior on a host, for diagnostic purposes.
   int32_t hash_seed = kHostHashSeed;
 
+  // EXPERIMENTAL: If > 0, enables a frequency-based (TinyLFU) admission
+  // filter. Recent accesses (Lookups) are recorded in a compact count-min
+  // sketch sized to track about this many distinct keys, which should be
+  // roughly the expected number of entries in the cache. When an Insert would
+  // have to evict, the new entry is only admitted if it has been accessed more
+  // often than the entry that would be evicted first (LRUCache), or has been
+  // accessed at least twice recently (HyperClockCache, which has no cheap way
+  // to identify the next victim). This protects a hot working set from being
+  // flushed out by one-time accesses such as a large scan.
+  //
+  // A rejected Insert without a handle requested behaves as if the entry were
+  // inserted and immediately evicted. If a handle is requested, an uncharged
+  // standalone handle (see Cache::CreateStandalone) is returned instead, and
+  // the entry is freed when that handle is released.
+  size_t frequency_admission_entries = 0;
+
   ShardedCacheOptions() {}
   ShardedCacheOptions(
       size_t _capacity, int _num_shard_bits, bool _strict_capacity_limit,
@@ -243,6 +260,21 @@ struct LRUCacheOptions : public ShardedCacheOptions {
   // -DROCKSDB_DEFAULT_TO_ADAPTIVE_MUTEX, false otherwise.
   bool use_adaptive_mutex = kDefaultToAdaptiveMutex;
 
+  // EXPERIMENTAL: If true, each shard tunes its high-priority pool ratio at
+  // runtime, starting from high_pri_pool_ratio, instead of keeping it fixed.
+  // The shard remembers the hashes of recently evicted entries ("ghost"
+  // entries), split into those that qualified for the high-priority pool
+  // (high-priority entries such as index and filter blocks, or entries with
+  // hits) and the rest. Re-inserting a ghost entry is a miss that a larger
+  // share for its class would have avoided, so the high-priority pool grows
+  // or shrinks by the entry's charge accordingly, similar to the adaptation
+  // in the ARC replacement policy. The high-priority pool ratio stays within
+  // [0.05, 0.95 - low_pri_pool_ratio], and low_pri_pool_ratio is unchanged.
+  //
+  // This replaces manual retuning of high_pri_pool_ratio as workloads drift.
+  // SetHighPriorityPoolRatio() still resets the current ratio.
+  bool adaptive_pool_ratios = false;
+
   LRUCacheOptions() {}
   LRUCacheOptions(size_t _capacity, int _num_shard_bits,
                   bool _strict_capacity_limit, double _high_pri_pool_ratio,
@@ -313,6 +345,14 @@ struct CompressedSecondaryCacheOptions : LRUCacheOptions {
   // (Filter blocks are essentially non-compressible but others usually are.)
   CacheEntryRoleSet do_not_compress_roles = {CacheEntryRole::kFilterBlock};
 
+  // EXPERIMENTAL: If true, entries are kept in a lock-free HyperClockCache
+  // (with automatic table sizing, see HyperClockCacheOptions) instead of an
+  // LRUCache, avoiding shard mutex contention when many threads look up or
+  // insert into the secondary cache at once. The LRUCache-specific options
+  // (high_pri_pool_ratio, low_pri_pool_ratio, use_adaptive_mutex) are then
+  // ignored. Like HyperClockCache, this only supports block cache keys.
+  bool use_hyper_clock_cache = false;
+
   CompressedSecondaryCacheOptions() {}
   CompressedSecondaryCacheOptions(
       size_t _capacity, int _num_shard_bits, bool _strict_capacity_limit,
@@ -576,4 +616,54 @@ Status UpdateTieredCache(
     const std::shared_ptr<Cache>& cache, int64_t total_capacity = -1,
     double compressed_secondary_ratio = std::numeric_limits<double>::max(),
     TieredAdmissionPolicy adm_policy = TieredAdmissionPolicy::kAdmPolicyMax);
+
+// EXPERIMENTAL
+// Shares of the capacity of a PartitionedCache for one partition, as
+// fractions of PartitionedCacheOptions::total_capacity.
+struct CachePartitionOptions {
+  // Capacity the partition can always grow to, evicting entries of
+  // partitions that have borrowed it if needed.
+  double min_share = 0.0;
+  // Limit on the capacity of the partition, including borrowed capacity.
+  double max_share = 1.0;
+};
+
+// EXPERIMENTAL
+// A PartitionedCache lets many tenants, such as column families or DBs,
+// share a block cache memory budget with isolation. Each tenant uses one
+// partition, e.g. as the BlockBasedTableOptions::block_cache of its column
+// families, and each partition evicts only its own entries while it is
+// within its shares. Capacity not used by a partition can be borrowed by
+// others beyond their min_share, and is reclaimed from the borrowers when
+// the owner needs it again.
+struct PartitionedCacheOptions {
+  // This should point to an instance of either LRUCacheOptions or
+  // HyperClockCacheOptions, depending on the cache_type, used for the cache
+  // of each partition. The capacity in those options is ignored.
+  ShardedCacheOptions* cache_opts = nullptr;
+  PrimaryCacheType cache_type = PrimaryCacheType::kCacheTypeLRU;
+  // The memory budget divided among the partitions
+  size_t total_capacity = 0;
+  // The sum of the min_share of all partitions must not exceed 1.
+  std::vector<CachePartitionOptions> partitions;
+};
+
+class PartitionedCache {
+ public:
+  virtual ~PartitionedCache() {}
+
+  // The cache of partition `i`. It remains usable after the
+  // PartitionedCache is destroyed. Its capacity is managed by the
+  // PartitionedCache, so SetCapacity() on it has no effect.
+  virtual std::shared_ptr<Cache> GetPartition(size_t i) const = 0;
+
+  virtual size_t NumPartitions() const = 0;
+
+  // The current capacity of partition `i`, including borrowed capacity
+  virtual size_t GetPartitionCapacity(size_t i) const = 0;
+};
+
+// EXPERIMENTAL
+Status NewPartitionedCache(const PartitionedCacheOptions& opts,
+                           std::shared_ptr<PartitionedCache>* cache);
 }  // namespace ROCKSDB_NAMESPACE
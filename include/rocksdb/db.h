@@ -11,12 +11,14 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "rocksdb/advanced_cache.h"
 #include "rocksdb/attribute_groups.h"
 #include "rocksdb/block_cache_trace_writer.h"
 #include "rocksdb/iterator.h"
@@ -121,12 +123,46 @@ struct GetMergeOperandsOptions {
   ContinueCallback continue_cb;
 };
 
+// Options for DB::PrefetchRange()
+struct PrefetchRangeOptions {
+  // Block cache priority of the prefetched data blocks. Index and filter
+  // blocks are cached with the priority they get on regular reads (see
+  // BlockBasedTableOptions::cache_index_and_filter_blocks_with_high_priority).
+  Cache::Priority data_block_priority = Cache::Priority::LOW;
+
+  // Adjacent data blocks of a file are read with I/Os of up to this many
+  // bytes. With ReadOptions::async_io, the next read of a file is issued
+  // while the blocks of the previous one are inserted into the block cache.
+  // 0 reads the blocks one at a time.
+  size_t readahead_size = 2 << 20;
+};
+
 // A collections of table properties objects, where
 //  key: is the table's file name.
 //  value: the table properties object of the given table.
 using TablePropertiesCollection =
     std::unordered_map<std::string, std::shared_ptr<const TableProperties>>;
 
+// Receives the batches of DB::ParallelScan(): the index of the sub-range, in
+// key order, and a batch of its key/value pairs, which may be moved from.
+using ParallelScanCallback = std::function<Status(
+    size_t partition, std::vector<std::pair<std::string, std::string>>& batch)>;
+
+// EXPERIMENTAL
+//
+// Handle of a read started by DB::MultiGetAsync() or DB::GetAsync().
+// Destroying the handle waits for the read to complete.
+class AsyncReadHandle {
+ public:
+  virtual ~AsyncReadHandle() {}
+
+  // Returns true once the values and statuses of the read are available
+  virtual bool IsReady() const = 0;
+
+  // Blocks until the values and statuses of the read are available
+  virtual void Wait() = 0;
+};
+
 // A DB is a persistent, versioned ordered map from keys to values.
 // A DB is safe for concurrent access from multiple threads without
 // any external synchronization.
@@ -1090,6 +1126,32 @@ class DB {
       const ReadOptions& options,
       const std::vector<ColumnFamilyHandle*>& column_families) = 0;
 
+  // EXPERIMENTAL
+  //
+  // Starts a MultiGet() that runs on `thread_pool`, for callers such as event
+  // loops that cannot block on reads, and returns without waiting for it.
+  // The key data, `values` and `statuses` must remain valid until the read
+  // completes. Once they are filled in, the returned handle becomes ready
+  // and then `callback`, if set, is invoked from the thread pool.
+  //
+  // Each request is served by one batched MultiGet(), so its reads from SST
+  // files are issued in parallel where the file system supports MultiRead().
+  // If `thread_pool` is nullptr, the read completes before returning.
+  virtual std::unique_ptr<AsyncReadHandle> MultiGetAsync(
+      const ReadOptions& options, ColumnFamilyHandle* column_family,
+      size_t num_keys, const Slice* keys, PinnableSlice* values,
+      Status* statuses, ThreadPool* thread_pool,
+      std::function<void()> callback = nullptr);
+
+  // Single key version of MultiGetAsync()
+  std::unique_ptr<AsyncReadHandle> GetAsync(
+      const ReadOptions& options, ColumnFamilyHandle* column_family,
+      const Slice& key, PinnableSlice* value, Status* status,
+      ThreadPool* thread_pool, std::function<void()> callback = nullptr) {
+    return MultiGetAsync(options, column_family, 1, &key, value, status,
+                         thread_pool, std::move(callback));
+  }
+
   // Get an iterator that scans multiple key ranges. The scan ranges should
   // be in increasing order of start key. See multi_scan_iterator.h for more
   // details.
@@ -1102,6 +1164,23 @@ class DB {
     return ms_iter;
   }
 
+  // EXPERIMENTAL
+  //
+  // Scans a key range of a column family with several threads, see
+  // ParallelScanOptions. All sub-ranges are read from the same snapshot,
+  // options.snapshot or an implicit one taken at the start of the call.
+  // options.iterate_lower_bound and options.iterate_upper_bound are ignored
+  // in favor of scan_opts.range.
+  //
+  // A non-OK status returned by the callback stops the scan and is returned,
+  // as is the first error from reading. Returns once all callbacks returned.
+  virtual Status ParallelScan(const ReadOptions& /*options*/,
+                              ColumnFamilyHandle* /*column_family*/,
+                              const ParallelScanOptions& /*scan_opts*/,
+                              const ParallelScanCallback& /*callback*/) {
+    return Status::NotSupported("ParallelScan() is not supported");
+  }
+
   // Return a handle to the current DB state.  Iterators created with
   // this handle will all observe a stable snapshot of the current DB
   // state.  The caller must call ReleaseSnapshot(result) when the
@@ -2101,6 +2180,28 @@ class DB {
       std::vector<std::unique_ptr<TablePropertiesCollection>>*
           props_by_level) = 0;
 
+  // Loads the index, filter and data blocks for the key range [*begin, *end]
+  // of all SST files in the current version into the block cache, so that
+  // the first reads of a range after e.g. moving it to this DB are served
+  // from memory. Blocks that are already cached are not read again.
+  // Memtables and blob files are not affected.
+  //
+  // begin==nullptr is treated as a key before all keys in the database, and
+  // end==nullptr as a key after all keys. ReadOptions::fill_cache must be
+  // true. Reads are charged to DBOptions::rate_limiter when
+  // ReadOptions::rate_limiter_priority is set. This call blocks until the
+  // blocks are loaded; call it from a separate thread to warm the cache in
+  // the background. Stops at the first error.
+  //
+  // In case of user-defined timestamp, `begin` and `end` should not contain
+  // timestamp.
+  virtual Status PrefetchRange(const ReadOptions& /*options*/,
+                               ColumnFamilyHandle* /*column_family*/,
+                               const PrefetchRangeOptions& /*prefetch_options*/,
+                               const Slice* /*begin*/, const Slice* /*end*/) {
+    return Status::NotSupported("PrefetchRange() is not implemented.");
+  }
+
   virtual Status SuggestCompactRange(ColumnFamilyHandle* /*column_family*/,
                                      const Slice* /*begin*/,
                                      const Slice* /*end*/) {
@@ -198,6 +198,13 @@ struct FileOptions : EnvOptions {
   // FSWritableFile object creation.
   Env::WriteLifeTimeHint write_hint = Env::WLTH_NOT_SET;
 
+  // EXPERIMENTAL
+  // The number of aligned buffers a direct I/O writer may rotate through.
+  // With more than one, a full buffer is submitted with
+  // FSWritableFile::PositionedAppendAsync() and the next buffer is filled
+  // while that write is in flight. 1 keeps all writes synchronous.
+  size_t writable_file_num_buffers = 1;
+
   FileOptions() : EnvOptions(), handoff_checksum_type(ChecksumType::kCRC32c) {}
 
   FileOptions(const DBOptions& opts)
@@ -213,7 +220,8 @@ struct FileOptions : EnvOptions {
         io_options(opts.io_options),
         temperature(opts.temperature),
         handoff_checksum_type(opts.handoff_checksum_type),
-        write_hint(opts.write_hint) {}
+        write_hint(opts.write_hint),
+        writable_file_num_buffers(opts.writable_file_num_buffers) {}
 
   FileOptions& operator=(const FileOptions&) = default;
 };
@@ -1114,6 +1122,28 @@ class FSWritableFile {
     return IOStatus::NotSupported("PositionedAppend");
   }
 
+  // EXPERIMENTAL
+  // Asynchronous version of PositionedAppend(): it submits the write and
+  // returns, and cb is called with the outcome of the write once it
+  // completes. The same alignment requirements as for
+  // PositionedAppend() apply, and data must remain valid until cb is called.
+  // Writes submitted this way never overlap each other.
+  //
+  // Like FSRandomAccessFile::ReadAsync(), the implementation populates
+  // io_handle and del_fn, and completions are reaped with FileSystem::Poll()
+  // (or cancelled with FileSystem::AbortIO()) on the submitting thread.
+  // RocksDB guarantees that all submitted writes are reaped before the file
+  // is closed or written synchronously past them.
+  //
+  // Default implementation is to write the data synchronously.
+  virtual IOStatus PositionedAppendAsync(
+      const Slice& data, uint64_t offset, const IOOptions& options,
+      std::function<void(const IOStatus&, void*)> cb, void* cb_arg,
+      void** /*io_handle*/, IOHandleDeleter* /*del_fn*/, IODebugContext* dbg) {
+    cb(PositionedAppend(data, offset, options, dbg), cb_arg);
+    return IOStatus::OK();
+  }
+
   // Truncate is necessary to trim the file to the correct size
   // before closing. It is not always possible to keep track of the file
   // size due to whole pages writes. The behavior is undefined if called
@@ -19,6 +19,8 @@
 #pragma once
 
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "rocksdb/iterator_base.h"
 #include "rocksdb/options.h"
@@ -26,6 +28,45 @@
 
 namespace ROCKSDB_NAMESPACE {
 
+// Key-value pairs returned by Iterator::NextBatch(). The keys and values are
+// copies, so they stay valid until the batch is cleared or destroyed, no
+// matter how the iterator moves.
+class IteratorBatch {
+ public:
+  // Number of entries in the batch
+  size_t size() const { return ends_.size(); }
+  bool empty() const { return ends_.empty(); }
+
+  Slice key(size_t i) const {
+    size_t begin = i == 0 ? 0 : ends_[i - 1].second;
+    return Slice(data_.data() + begin, ends_[i].first - begin);
+  }
+  Slice value(size_t i) const {
+    return Slice(data_.data() + ends_[i].first,
+                 ends_[i].second - ends_[i].first);
+  }
+
+  // Total size of the keys and values in the batch
+  size_t data_size() const { return data_.size(); }
+
+  void Add(const Slice& key, const Slice& value) {
+    data_.append(key.data(), key.size());
+    size_t key_end = data_.size();
+    data_.append(value.data(), value.size());
+    ends_.emplace_back(key_end, data_.size());
+  }
+
+  void Clear() {
+    data_.clear();
+    ends_.clear();
+  }
+
+ private:
+  std::string data_;
+  // End offsets in data_ of the key and of the value of each entry
+  std::vector<std::pair<size_t, size_t>> ends_;
+};
+
 class Iterator : public IteratorBase {
  public:
   Iterator() {}
@@ -95,6 +136,20 @@ class Iterator : public IteratorBase {
     return Slice();
   }
 
+  // Clears `batch` and adds the current entry and the entries after it,
+  // moving the iterator past them, until `max_entries` entries are added, the
+  // keys and values added take at least `max_bytes`, or the iterator is no
+  // longer Valid(). Afterwards the iterator is where the same number of
+  // Next() calls would have left it, so status() needs to be checked if it is
+  // not Valid(). The batch is empty if the iterator is not Valid() to begin
+  // with.
+  //
+  // This is faster than calling key(), value() and Next() for each entry, as
+  // it saves the virtual calls through the iterator wrappers for each entry.
+  // Stops early if PrepareValue() fails.
+  virtual void NextBatch(size_t max_entries, size_t max_bytes,
+                         IteratorBatch* batch);
+
   // RocksDB Internal - DO NOT USE
   // Prepare the iterator to scan the ranges specified in scan_opts. The
   // upper bound and other table specific limits may be specified. This will
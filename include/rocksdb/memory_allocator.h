@@ -6,6 +6,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "rocksdb/customizable.h"
 #include "rocksdb/status.h"
@@ -84,4 +85,63 @@ Status NewJemallocNodumpAllocator(
     const JemallocAllocatorOptions& options,
     std::shared_ptr<MemoryAllocator>* memory_allocator);
 
+struct SlabAllocatorOptions {
+  static const char* kName() { return "SlabAllocatorOptions"; }
+  // Allocation sizes served from slabs, in increasing order. Each allocation
+  // is rounded up to the smallest size class that fits it; allocations larger
+  // than the last size class go to the system allocator. Choosing size
+  // classes just above the typical block sizes (e.g. block_size plus a few
+  // bytes of slack for uncompressed blocks) minimizes internal
+  // fragmentation. If empty, four size classes per power of two between
+  // 128 bytes and 256KB are used.
+  std::vector<size_t> size_classes;
+
+  // Size of each slab, i.e. of each memory mapping carved into allocations of
+  // a single size class. When huge pages are used, this must be a multiple of
+  // the huge page size.
+  size_t slab_size = 2 << 20;
+
+  // Back slabs with huge pages to reduce TLB misses. Slabs are first requested
+  // from the reserved huge page pool (MAP_HUGETLB on Linux), then as regular
+  // mappings advised to use transparent huge pages where supported.
+  bool use_huge_pages = true;
+};
+
+// Memory usage of an allocator created by NewSlabMemoryAllocator().
+struct SlabAllocatorStats {
+  // Total size of the mapped slabs
+  size_t slab_bytes = 0;
+  // Number of slabs backed by the reserved huge page pool
+  size_t num_huge_page_slabs = 0;
+  // Slab memory of live allocations, including their rounding up to a size
+  // class. The difference from slab_bytes is memory cached in free lists or
+  // not yet carved from a slab.
+  size_t allocated_bytes = 0;
+  // Memory of live allocations served by the system allocator
+  size_t large_allocated_bytes = 0;
+};
+
+// Generate a memory allocator which carves fixed size-class allocations out
+// of large (ideally huge page backed) slabs. Compared to a general purpose
+// allocator, this bounds fragmentation for block cache workloads that mix a
+// few block sizes and reduces TLB misses when scanning cached blocks.
+//
+// Freed allocations are kept in per-core free lists, which exchange batches
+// with a per-size-class global free list, so slab memory is never returned to
+// the system before the allocator is destroyed. Up to one partially carved
+// slab per size class in use is mapped but not yet allocated.
+//
+// Because MemoryAllocator::UsableSize() reports the size class of an
+// allocation, a cache using this allocator charges rounding overhead to its
+// entries. The remaining overhead (slab_bytes - allocated_bytes from
+// GetSlabMemoryAllocatorStats()) can be charged to a cache separately.
+Status NewSlabMemoryAllocator(
+    const SlabAllocatorOptions& options,
+    std::shared_ptr<MemoryAllocator>* memory_allocator);
+
+// Reports the memory usage of an allocator created by NewSlabMemoryAllocator(),
+// or returns InvalidArgument for other allocators.
+Status GetSlabMemoryAllocatorStats(const MemoryAllocator& memory_allocator,
+                                   SlabAllocatorStats* stats);
+
 }  // namespace ROCKSDB_NAMESPACE
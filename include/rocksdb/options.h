@@ -54,6 +54,7 @@ class MemTableRepFactory;
 class RateLimiter;
 class Slice;
 class Statistics;
+class ThreadPool;
 class InternalKeyComparator;
 class WalFilter;
 class FileSystem;
@@ -63,7 +64,7 @@ struct DbPath;
 
 using FileTypeSet = SmallEnumSet<FileType, FileType::kBlobFile>;
 using CompactionStyleSet =
-    SmallEnumSet<CompactionStyle, CompactionStyle::kCompactionStyleNone>;
+    SmallEnumSet<CompactionStyle, CompactionStyle::kCompactionStyleHybrid>;
 
 struct ColumnFamilyOptions : public AdvancedColumnFamilyOptions {
   // The function recovers options to a previous version. Only 4.6 or later
@@ -1059,6 +1060,24 @@ struct DBOptions {
   // Default: 1MB
   size_t stats_history_buffer_size = 1024 * 1024;
 
+  // EXPERIMENTAL
+  // If not zero, every block_cache_manifest_period_sec seconds and when the
+  // DB is closed, record which data, index and filter blocks of the DB's SST
+  // files are in the block cache to a BLOCK_CACHE_MANIFEST file in the DB
+  // directory. Only the file numbers and offsets of the blocks are recorded,
+  // so the file is small compared to a cache dump (see
+  // utilities/cache_dump_load.h).
+  //
+  // When a DB is opened with this option and such a file exists, the listed
+  // blocks that are still in live SST files are read back into the block
+  // cache by a background job in the LOW priority thread pool, blocks of
+  // files in lower levels first. The reads are charged to `rate_limiter`
+  // at Env::IO_LOW priority. This shortens the time for a restarted DB to
+  // reach its previous block cache hit rate.
+  //
+  // Default: 0 (disabled)
+  uint64_t block_cache_manifest_period_sec = 0;
+
   // If set true, will hint the underlying file system that the file
   // access pattern is random, when a sst file is opened.
   // Default: true
@@ -1102,6 +1121,22 @@ struct DBOptions {
   // Dynamically changeable through SetDBOptions() API.
   size_t compaction_readahead_size = 2 * 1024 * 1024;
 
+  // Number of readahead buffers RocksDB's internal prefetch buffer keeps per
+  // compaction input file when it is used for compaction readahead, i.e. with
+  // use_direct_reads or when the FileSystem does not support Prefetch(). With
+  // 1, the next chunk of compaction_readahead_size bytes is read synchronously
+  // once the current one is consumed. With a value greater than 1, each chunk
+  // is split into halves: the half needed right away is read synchronously and
+  // the following num_buffers - 1 halves are submitted through
+  // FSRandomAccessFile::ReadAsync, so every input file of a compaction keeps
+  // its upcoming data in flight while the compaction works on the current
+  // block. This helps on storage with high per-I/O latency. Asynchronously
+  // submitted reads bypass the FileSystem Prefetch() path and are not charged
+  // to the rate limiter.
+  //
+  // Default: 1
+  size_t compaction_readahead_num_buffers = 1;
+
   // This is the maximum buffer size that is used by WritableFileWriter.
   // With direct IO, we need to maintain an aligned buffer for writes.
   // We allow the buffer to grow until it's size hits the limit in buffered
@@ -1113,6 +1148,17 @@ struct DBOptions {
   // Dynamically changeable through SetDBOptions() API.
   size_t writable_file_max_buffer_size = 1024 * 1024;
 
+  // Number of writable_file_max_buffer_size buffers used per SST file written
+  // by flush and compaction with use_direct_io_for_flush_and_compaction. With
+  // a value greater than 1, a full buffer is submitted through
+  // FSWritableFile::PositionedAppendAsync (io_uring on Linux when available)
+  // and the table builder keeps filling the next buffer while up to
+  // num_buffers - 1 writes are in flight. Has no effect on buffered writes or
+  // when checksum handoff is enabled for table files.
+  //
+  // Default: 1
+  size_t flush_and_compaction_write_num_buffers = 1;
+
   // Use adaptive mutex, which spins in the user space before resorting
   // to kernel. This could reduce context switch when the mutex is not
   // heavily contended. However, if the mutex is hot, we could end up
@@ -1321,6 +1367,21 @@ struct DBOptions {
   // Default: nullptr (disabled)
   std::shared_ptr<RowCache> row_cache = nullptr;
 
+  // EXPERIMENTAL
+  // A cache of point lookups that found no value, keyed by column family and
+  // user key. A repeated Get() of an absent key is answered from this cache
+  // without searching the memtables or SST files, as long as no write to the
+  // key (or to another key hashing to the same invalidation slot) and no
+  // file or WriteBatchWithIndex ingestion into the column family has happened
+  // since the miss was recorded. Unlike row_cache, entries are per DB rather
+  // than per SST file, so they survive flushes and compactions.
+  //
+  // Only used by Get() on the default read tier, without user-defined
+  // timestamps, read callbacks or ignore_range_deletions. Not compatible with
+  // unordered_write.
+  // Default: nullptr (disabled)
+  std::shared_ptr<Cache> negative_lookup_cache = nullptr;
+
   // A filter object supplied to be invoked while processing write-ahead-logs
   // (WALs) during recovery. The filter provides a way to inspect log
   // records, ignoring a particular record or skipping replay.
@@ -1771,6 +1832,41 @@ struct ScanOptions {
       : range(_start, _upper_bound) {}
 };
 
+// EXPERIMENTAL
+//
+// Options for DB::ParallelScan(). The key range is split into sub-ranges of
+// roughly equal size, based on the SST files of the column family, and the
+// sub-ranges are scanned concurrently.
+struct ParallelScanOptions {
+  // The range to scan. Unset endpoints refer to before the first and after
+  // the last key.
+  RangeOpt range;
+
+  // Maximum number of sub-ranges to scan concurrently. Fewer are used when
+  // the SST files do not provide enough split points, e.g. when most of the
+  // data is still in memtables.
+  size_t max_partitions = 4;
+
+  // Approximate total size of the keys and values in each batch passed to
+  // the callback.
+  size_t batch_size = 1 << 20;
+
+  // If true, the callback is invoked from the calling thread, one batch at a
+  // time and in key order. Each sub-range buffers up to
+  // max_buffered_batches batches while waiting for the preceding sub-ranges
+  // to be delivered.
+  //
+  // If false, the callback may be invoked concurrently from several threads,
+  // with the batches of each sub-range in key order but no ordering across
+  // sub-ranges.
+  bool ordered = false;
+  size_t max_buffered_batches = 4;
+
+  // Thread pool to scan the sub-ranges on. If nullptr, a thread is created for
+  // each sub-range for the duration of the scan.
+  ThreadPool* thread_pool = nullptr;
+};
+
 // Options that control read operations
 struct ReadOptions {
   // *** BEGIN options relevant to point lookups as well as scans ***
@@ -1877,6 +1973,18 @@ struct ReadOptions {
   // comes at the expense of slightly higher CPU overhead.
   bool optimize_multiget_for_io = true;
 
+  // EXPERIMENTAL
+  //
+  // If true, MultiGet first starts reads of the data blocks that might hold
+  // the keys in every SST file and level that could contain them, and waits
+  // for them together, before looking the keys up level by level. The blocks
+  // are read into the block cache with FSRandomAccessFile::ReadAsync(), so
+  // this only helps with a block cache and a file system that supports async
+  // reads, and does not require coroutine support like async_io does. It
+  // trades reading blocks that turn out not to be needed, because a key was
+  // found in an earlier level, for lower MultiGet latency.
+  bool speculative_multiget_reads = false;
+
   // *** END options relevant to point lookups (as well as scans) ***
   // *** BEGIN options only relevant to iterators or scans ***
 
@@ -217,4 +217,37 @@ class SecondaryCacheWrapper : public SecondaryCache {
 // secondary cache, such as compressed blocks
 extern const Cache::CacheItemHelper kSliceCacheItemHelper;
 
+// EXPERIMENTAL
+// Options for a SecondaryCache that keeps entries in a file on local flash
+// (e.g. NVMe SSD), typically used as TieredCacheOptions::nvm_sec_cache.
+//
+// The file is divided into fixed-size regions that are filled in a
+// log-structured fashion: inserted entries are appended to an in-memory
+// region buffer, which is written out with a single large write once full.
+// When all regions are used, the oldest region is recycled and all of its
+// entries are dropped (FIFO eviction). Only a compact index of entry
+// locations is kept in memory, and Lookup() with wait=false reads the entry
+// using FSRandomAccessFile::ReadAsync, completing in Wait()/WaitAll(). Cache
+// contents are not preserved across re-creating the cache.
+struct NvmSecondaryCacheOptions {
+  // Path of the cache file. It is created, or truncated if it exists.
+  std::string path;
+
+  // Maximum size of the cache file, in bytes. Rounded down to a multiple of
+  // region_size, and must allow for at least two regions.
+  size_t capacity = 0;
+
+  // Size of each region, which is the unit of writing and of eviction.
+  // Entries larger than a region are not cached.
+  size_t region_size = 16 << 20;
+
+  // The FileSystem holding `path`. If nullptr, FileSystem::Default() is used.
+  std::shared_ptr<FileSystem> file_system;
+};
+
+// Creates a SecondaryCache as described by NvmSecondaryCacheOptions,
+// returning a non-OK status if the cache file cannot be set up.
+Status NewNvmSecondaryCache(const NvmSecondaryCacheOptions& opts,
+                            std::shared_ptr<SecondaryCache>* result);
+
 }  // namespace ROCKSDB_NAMESPACE
@@ -542,6 +542,11 @@ enum Tickers : uint32_t {
   // TransactionOptions::large_txn_commit_optimize_threshold.
   NUMBER_WBWI_INGEST,
 
+  // Number of Get() calls answered by, or that missed in,
+  // DBOptions::negative_lookup_cache
+  NEGATIVE_LOOKUP_CACHE_HIT,
+  NEGATIVE_LOOKUP_CACHE_MISS,
+
   TICKER_ENUM_MAX
 };
 
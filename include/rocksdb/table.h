@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "rocksdb/cache.h"
 #include "rocksdb/customizable.h"
@@ -274,6 +275,18 @@ struct BlockBasedTableOptions {
   // kDataBlockBinaryAndHash.
   double data_block_hash_table_util_ratio = 0.75;
 
+  // EXPERIMENTAL
+  // If true, data blocks smaller than 64KiB store, for every entry, where the
+  // previous entry starts and the bytes of the previous key that cannot be
+  // decoded from the current one. Iterating backwards then steps from entry
+  // to entry, instead of decoding each restart interval forward from its
+  // start, which makes reverse scans about as fast as forward scans. This
+  // costs about 4 bytes per key plus the bytes of some keys in each block.
+  //
+  // Data blocks written with this option cannot be read by older versions
+  // of RocksDB.
+  bool data_block_back_links = false;
+
   // Option hash_index_allow_collision is now deleted.
   // It will behave as if hash_index_allow_collision=true.
 
@@ -498,6 +511,20 @@ struct BlockBasedTableOptions {
   // This must generally be true for gets to be efficient.
   bool whole_key_filtering = true;
 
+  // EXPERIMENTAL
+  // If non-empty and filter_policy is set, each SST file also gets a range
+  // filter: a filter over the prefixes of each of these lengths of every key.
+  // A seek with ReadOptions::iterate_upper_bound set consults it when the
+  // seek key and the upper bound share a prefix of one of these lengths, and
+  // skips the file without reading its index or data blocks if no key in the
+  // file has that prefix. This lets short scans over empty ranges avoid
+  // most block reads without a prefix_extractor.
+  //
+  // Only used with the bytewise comparators (without user-defined
+  // timestamps). Each length adds roughly one filter entry per distinct
+  // prefix of that length in the file.
+  std::vector<size_t> range_filter_prefix_lengths;
+
   // If true, detect corruption during Bloom Filter (format_version >= 5)
   // and Ribbon Filter construction.
   //
@@ -296,6 +296,14 @@ class StackableDB : public DB {
     return db_->NewMultiScan(opts, column_family, scan_opts);
   }
 
+  using DB::ParallelScan;
+  Status ParallelScan(const ReadOptions& options,
+                      ColumnFamilyHandle* column_family,
+                      const ParallelScanOptions& scan_opts,
+                      const ParallelScanCallback& callback) override {
+    return db_->ParallelScan(options, column_family, scan_opts, callback);
+  }
+
   const Snapshot* GetSnapshot() override { return db_->GetSnapshot(); }
 
   void ReleaseSnapshot(const Snapshot* snapshot) override {
@@ -580,6 +588,14 @@ class StackableDB : public DB {
     return db_->GetUpdatesSince(seq_number, iter, read_options);
   }
 
+  Status PrefetchRange(const ReadOptions& options,
+                       ColumnFamilyHandle* column_family,
+                       const PrefetchRangeOptions& prefetch_options,
+                       const Slice* begin, const Slice* end) override {
+    return db_->PrefetchRange(options, column_family, prefetch_options, begin,
+                              end);
+  }
+
   Status SuggestCompactRange(ColumnFamilyHandle* column_family,
                              const Slice* begin, const Slice* end) override {
     return db_->SuggestCompactRange(column_family, begin, end);
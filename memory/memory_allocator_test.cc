@@ -8,6 +8,7 @@
 
 #include "memory/jemalloc_nodump_allocator.h"
 #include "memory/memkind_kmem_allocator.h"
+#include "memory/slab_memory_allocator.h"
 #include "rocksdb/cache.h"
 #include "rocksdb/convenience.h"
 #include "rocksdb/db.h"
@@ -209,9 +210,75 @@ TEST_F(CreateMemoryAllocatorTest, NewJemallocNodumpAllocator) {
   ASSERT_EQ(opts->limit_tcache_size, jopts.limit_tcache_size);
 }
 
+TEST_F(CreateMemoryAllocatorTest, NewSlabMemoryAllocator) {
+  std::shared_ptr<MemoryAllocator> allocator;
+  SlabAllocatorOptions sopts;
+  ASSERT_NOK(NewSlabMemoryAllocator(sopts, nullptr));
+  sopts.size_classes = {4096, 1024};
+  ASSERT_TRUE(NewSlabMemoryAllocator(sopts, &allocator).IsInvalidArgument());
+  sopts.size_classes = {1024, 4096};
+  sopts.slab_size = 4096;
+  ASSERT_TRUE(NewSlabMemoryAllocator(sopts, &allocator).IsInvalidArgument());
+  ASSERT_EQ(allocator, nullptr);
+
+  sopts.slab_size = 64 << 10;
+  sopts.use_huge_pages = false;
+  ASSERT_OK(NewSlabMemoryAllocator(sopts, &allocator));
+  ASSERT_NE(allocator, nullptr);
+  ASSERT_EQ(allocator->GetOptions<SlabAllocatorOptions>()->slab_size,
+            sopts.slab_size);
+
+  // Allocations are rounded up to their size class
+  void* small = allocator->Allocate(1000);
+  ASSERT_EQ(allocator->UsableSize(small, 1000), 1024U);
+  void* medium = allocator->Allocate(1025);
+  ASSERT_EQ(allocator->UsableSize(medium, 1025), 4096U);
+  // Larger allocations come from the system allocator
+  void* large = allocator->Allocate(5000);
+  ASSERT_EQ(allocator->UsableSize(large, 5000), 5000U);
+  memset(small, 'a', 1024);
+  memset(medium, 'b', 4096);
+  memset(large, 'c', 5000);
+
+  SlabAllocatorStats stats;
+  ASSERT_OK(GetSlabMemoryAllocatorStats(*allocator, &stats));
+  ASSERT_EQ(stats.slab_bytes, 2 * sopts.slab_size);
+  ASSERT_EQ(stats.num_huge_page_slabs, 0U);
+  ASSERT_EQ(stats.allocated_bytes, 1024U + 4096U + 2U * 16U);
+  ASSERT_EQ(stats.large_allocated_bytes, 5000U);
+
+  allocator->Deallocate(small);
+  allocator->Deallocate(medium);
+  allocator->Deallocate(large);
+  ASSERT_OK(GetSlabMemoryAllocatorStats(*allocator, &stats));
+  ASSERT_EQ(stats.allocated_bytes, 0U);
+  ASSERT_EQ(stats.large_allocated_bytes, 0U);
+
+  // Freed memory is reused before mapping more slabs
+  for (int round = 0; round < 3; round++) {
+    std::vector<void*> ptrs;
+    for (int i = 0; i < 200; i++) {
+      ptrs.push_back(allocator->Allocate(1000));
+      memset(ptrs.back(), i, 1000);
+    }
+    for (void* p : ptrs) {
+      allocator->Deallocate(p);
+    }
+  }
+  ASSERT_OK(GetSlabMemoryAllocatorStats(*allocator, &stats));
+  ASSERT_EQ(stats.allocated_bytes, 0U);
+  ASSERT_LE(stats.slab_bytes, 8 * sopts.slab_size);
+
+  DefaultMemoryAllocator other;
+  ASSERT_TRUE(GetSlabMemoryAllocatorStats(other, &stats).IsInvalidArgument());
+}
+
 INSTANTIATE_TEST_CASE_P(DefaultMemoryAllocator, MemoryAllocatorTest,
                         ::testing::Values(std::make_tuple(
                             DefaultMemoryAllocator::kClassName(), true)));
+INSTANTIATE_TEST_CASE_P(SlabMemoryAllocator, MemoryAllocatorTest,
+                        ::testing::Values(std::make_tuple(
+                            SlabMemoryAllocator::kClassName(), true)));
 #ifdef MEMKIND
 INSTANTIATE_TEST_CASE_P(
     MemkindkMemAllocator, MemoryAllocatorTest,
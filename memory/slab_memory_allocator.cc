@@ -0,0 +1,257 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "memory/slab_memory_allocator.h"
+
+#include <algorithm>
+#include <mutex>
+
+#ifdef ROCKSDB_PLATFORM_POSIX
+#include <sys/mman.h>
+#endif  // ROCKSDB_PLATFORM_POSIX
+
+#include "rocksdb/convenience.h"
+#include "rocksdb/utilities/options_type.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+static std::unordered_map<std::string, OptionTypeInfo> slab_type_info = {
+    {"size_classes",
+     OptionTypeInfo::Vector<size_t>(
+         offsetof(struct SlabAllocatorOptions, size_classes),
+         OptionVerificationType::kNormal, OptionTypeFlags::kNone,
+         {0, OptionType::kSizeT})},
+    {"slab_size",
+     {offsetof(struct SlabAllocatorOptions, slab_size), OptionType::kSizeT,
+      OptionVerificationType::kNormal, OptionTypeFlags::kNone}},
+    {"use_huge_pages",
+     {offsetof(struct SlabAllocatorOptions, use_huge_pages),
+      OptionType::kBoolean, OptionVerificationType::kNormal,
+      OptionTypeFlags::kNone}},
+};
+
+SlabMemoryAllocator::SlabMemoryAllocator(const SlabAllocatorOptions& options)
+    : options_(options) {
+  RegisterOptions(&options_, &slab_type_info);
+}
+
+Status SlabMemoryAllocator::PrepareOptions(
+    const ConfigOptions& config_options) {
+  std::vector<size_t> sizes = options_.size_classes;
+  if (sizes.empty()) {
+    for (size_t size = 128; size < (256 << 10); size *= 2) {
+      for (size_t quarters = 4; quarters < 8; quarters++) {
+        sizes.push_back(size * quarters / 4);
+      }
+    }
+    sizes.push_back(256 << 10);
+  }
+  for (size_t i = 0; i < sizes.size(); i++) {
+    if (sizes[i] == 0 || (i > 0 && sizes[i] <= sizes[i - 1])) {
+      return Status::InvalidArgument(
+          "size_classes must be positive and increasing");
+    }
+  }
+  // Keep allocations aligned like malloc()
+  size_t max_object_size = (sizes.back() + kHeaderSize + 15) & ~size_t{15};
+  if (options_.slab_size < max_object_size) {
+    return Status::InvalidArgument(
+        "slab_size must fit an allocation of the largest size class");
+  }
+
+  size_classes_.clear();
+  size_classes_.resize(sizes.size());
+  for (size_t i = 0; i < sizes.size(); i++) {
+    SizeClass& sc = size_classes_[i];
+    sc.object_size = (sizes[i] + kHeaderSize + 15) & ~size_t{15};
+    sc.batch_size = std::max(kBatchBytes / sc.object_size, size_t{1});
+  }
+  shards_.reset(new CoreLocalArray<Shard>());
+  for (size_t i = 0; i < shards_->Size(); i++) {
+    shards_->AccessAtCore(i)->free_lists.resize(size_classes_.size());
+  }
+  return MemoryAllocator::PrepareOptions(config_options);
+}
+
+void* SlabMemoryAllocator::Allocate(size_t size) {
+  assert(shards_);
+  size_t object_size = size + kHeaderSize;
+  auto it = std::lower_bound(
+      size_classes_.begin(), size_classes_.end(), object_size,
+      [](const SizeClass& sc, size_t s) { return sc.object_size < s; });
+  if (it == size_classes_.end()) {
+    return AllocateLarge(size);
+  }
+  size_t size_class = static_cast<size_t>(it - size_classes_.begin());
+
+  char* obj;
+  {
+    Shard* shard = shards_->Access();
+    std::lock_guard<SpinMutex> lock(shard->mutex);
+    FreeList* list = &shard->free_lists[size_class];
+    if (list->head == nullptr && !Refill(size_class, list)) {
+      obj = nullptr;
+    } else {
+      obj = Pop(list);
+      shard->allocated_bytes += static_cast<int64_t>(it->object_size);
+    }
+  }
+  if (obj == nullptr) {
+    // Out of mappable memory; let the system allocator decide
+    return AllocateLarge(size);
+  }
+  reinterpret_cast<Header*>(obj)->size_class = size_class;
+  return obj + kHeaderSize;
+}
+
+void* SlabMemoryAllocator::AllocateLarge(size_t size) {
+  char* obj = new char[size + kHeaderSize];
+  Header* header = reinterpret_cast<Header*>(obj);
+  header->size_class = kLargeSizeClass;
+  header->large_size = size;
+  large_allocated_bytes_.fetch_add(size, std::memory_order_relaxed);
+  return obj + kHeaderSize;
+}
+
+void SlabMemoryAllocator::Deallocate(void* p) {
+  char* obj = static_cast<char*>(p) - kHeaderSize;
+  uint64_t size_class = reinterpret_cast<Header*>(obj)->size_class;
+  if (size_class == kLargeSizeClass) {
+    large_allocated_bytes_.fetch_sub(
+        reinterpret_cast<Header*>(obj)->large_size, std::memory_order_relaxed);
+    delete[] obj;
+    return;
+  }
+  assert(size_class < size_classes_.size());
+  const SizeClass& sc = size_classes_[size_class];
+  Shard* shard = shards_->Access();
+  std::lock_guard<SpinMutex> lock(shard->mutex);
+  FreeList* list = &shard->free_lists[size_class];
+  Push(list, obj);
+  shard->allocated_bytes -= static_cast<int64_t>(sc.object_size);
+  // Keep up to two batches per core, so that alternating allocations and
+  // frees do not bounce batches through the global free list
+  if (list->count >= 2 * sc.batch_size) {
+    Release(size_class, list);
+  }
+}
+
+size_t SlabMemoryAllocator::UsableSize(void* p,
+                                       size_t allocation_size) const {
+  const Header* header =
+      reinterpret_cast<const Header*>(static_cast<char*>(p) - kHeaderSize);
+  if (header->size_class == kLargeSizeClass) {
+    return allocation_size;
+  }
+  return size_classes_[header->size_class].object_size - kHeaderSize;
+}
+
+bool SlabMemoryAllocator::Refill(size_t size_class, FreeList* list) {
+  SizeClass& sc = size_classes_[size_class];
+  MutexLock lock(&mutex_);
+  while (list->count < sc.batch_size && sc.free.head != nullptr) {
+    Push(list, Pop(&sc.free));
+  }
+  while (list->count < sc.batch_size) {
+    if (static_cast<size_t>(sc.carve_end - sc.carve_begin) < sc.object_size) {
+      if (list->count > 0) {
+        break;
+      }
+      // The remainder of the previous slab, if any, is left unused
+      char* slab = NewSlab();
+      if (slab == nullptr) {
+        return false;
+      }
+      sc.carve_begin = slab;
+      sc.carve_end = slab + options_.slab_size;
+    }
+    Push(list, sc.carve_begin);
+    sc.carve_begin += sc.object_size;
+  }
+  return true;
+}
+
+void SlabMemoryAllocator::Release(size_t size_class, FreeList* list) {
+  SizeClass& sc = size_classes_[size_class];
+  MutexLock lock(&mutex_);
+  for (size_t i = 0; i < sc.batch_size; i++) {
+    Push(&sc.free, Pop(list));
+  }
+}
+
+char* SlabMemoryAllocator::NewSlab() {
+  mutex_.AssertHeld();
+  const size_t length = options_.slab_size;
+  const bool try_huge =
+      options_.use_huge_pages && MemMapping::kHugePageSupported;
+  MemMapping slab = try_huge ? MemMapping::AllocateHuge(length)
+                             : MemMapping::AllocateLazyZeroed(length);
+  const bool huge = try_huge && slab.Get() != nullptr;
+  if (!huge) {
+    if (try_huge) {
+      // No reserved huge pages available
+      slab = MemMapping::AllocateLazyZeroed(length);
+    }
+    if (slab.Get() == nullptr) {
+      return nullptr;
+    }
+#if defined(ROCKSDB_PLATFORM_POSIX) && defined(MADV_HUGEPAGE)
+    if (options_.use_huge_pages) {
+      // Best effort, depending on the transparent huge page configuration
+      madvise(slab.Get(), length, MADV_HUGEPAGE);
+    }
+#endif  // ROCKSDB_PLATFORM_POSIX && MADV_HUGEPAGE
+  } else {
+    num_huge_page_slabs_++;
+  }
+  char* addr = static_cast<char*>(slab.Get());
+  slabs_.push_back(std::move(slab));
+  return addr;
+}
+
+void SlabMemoryAllocator::GetStats(SlabAllocatorStats* stats) const {
+  int64_t allocated_bytes = 0;
+  if (shards_) {
+    for (size_t i = 0; i < shards_->Size(); i++) {
+      Shard* shard = shards_->AccessAtCore(i);
+      std::lock_guard<SpinMutex> lock(shard->mutex);
+      allocated_bytes += shard->allocated_bytes;
+    }
+  }
+  stats->allocated_bytes = static_cast<size_t>(std::max<int64_t>(
+      allocated_bytes, 0));
+  stats->large_allocated_bytes =
+      large_allocated_bytes_.load(std::memory_order_relaxed);
+  MutexLock lock(&mutex_);
+  stats->slab_bytes = slabs_.size() * options_.slab_size;
+  stats->num_huge_page_slabs = num_huge_page_slabs_;
+}
+
+Status NewSlabMemoryAllocator(
+    const SlabAllocatorOptions& options,
+    std::shared_ptr<MemoryAllocator>* memory_allocator) {
+  if (memory_allocator == nullptr) {
+    return Status::InvalidArgument("memory_allocator must be non-null.");
+  }
+  std::unique_ptr<MemoryAllocator> allocator(new SlabMemoryAllocator(options));
+  Status s = allocator->PrepareOptions(ConfigOptions());
+  if (s.ok()) {
+    memory_allocator->reset(allocator.release());
+  }
+  return s;
+}
+
+Status GetSlabMemoryAllocatorStats(const MemoryAllocator& memory_allocator,
+                                   SlabAllocatorStats* stats) {
+  const auto* slab_allocator =
+      memory_allocator.CheckedCast<SlabMemoryAllocator>();
+  if (slab_allocator == nullptr) {
+    return Status::InvalidArgument("Not a SlabMemoryAllocator");
+  }
+  slab_allocator->GetStats(stats);
+  return Status::OK();
+}
+
+}  // namespace ROCKSDB_NAMESPACE
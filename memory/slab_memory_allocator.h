@@ -0,0 +1,123 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "port/mmap.h"
+#include "port/port.h"
+#include "rocksdb/memory_allocator.h"
+#include "util/core_local.h"
+#include "util/mutexlock.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+// See NewSlabMemoryAllocator() for an overview.
+//
+// Every allocation is preceded by a kHeaderSize byte header recording its
+// size class, so that Deallocate() and UsableSize() need no lookup. While an
+// allocation is in a free list, the header holds the next free allocation.
+class SlabMemoryAllocator : public MemoryAllocator {
+ public:
+  explicit SlabMemoryAllocator(const SlabAllocatorOptions& options);
+
+  static const char* kClassName() { return "SlabMemoryAllocator"; }
+  const char* Name() const override { return kClassName(); }
+
+  // Computes and validates the size classes. Must succeed before use.
+  Status PrepareOptions(const ConfigOptions& config_options) override;
+
+  void* Allocate(size_t size) override;
+  void Deallocate(void* p) override;
+  size_t UsableSize(void* p, size_t allocation_size) const override;
+
+  void GetStats(SlabAllocatorStats* stats) const;
+
+  static constexpr size_t kHeaderSize = 16;
+  // Size class recorded for allocations from the system allocator
+  static constexpr uint64_t kLargeSizeClass = ~uint64_t{0};
+  // Target number of bytes moved between a core-local and the global free
+  // list at a time
+  static constexpr size_t kBatchBytes = 64 << 10;
+
+ private:
+  struct Header {
+    // Index into size_classes_, or kLargeSizeClass
+    uint64_t size_class;
+    union {
+      // Allocation size, for kLargeSizeClass
+      uint64_t large_size;
+      // Next free allocation, while in a free list
+      char* next_free;
+    };
+  };
+  static_assert(sizeof(Header) == kHeaderSize, "");
+
+  struct FreeList {
+    char* head = nullptr;
+    size_t count = 0;
+  };
+
+  struct SizeClass {
+    // Size of each allocation including its header
+    size_t object_size;
+    // Number of allocations exchanged with the global free list at a time
+    size_t batch_size;
+    // Global free list, protected by mutex_
+    FreeList free;
+    // Not yet carved remainder of the latest slab, protected by mutex_
+    char* carve_begin = nullptr;
+    char* carve_end = nullptr;
+  };
+
+  struct ALIGN_AS(CACHE_LINE_SIZE) Shard {
+    SpinMutex mutex;
+    // One per size class
+    std::vector<FreeList> free_lists;
+    // Net object bytes allocated through this shard. Can be negative since
+    // an allocation may be freed on a different core.
+    int64_t allocated_bytes = 0;
+  };
+
+  // Moves up to a batch of allocations of the size class from the global free
+  // list, or from newly carved slab memory, into `list`. Returns false if no
+  // slab could be mapped.
+  bool Refill(size_t size_class, FreeList* list);
+  // Moves a batch of allocations from `list` to the global free list
+  void Release(size_t size_class, FreeList* list);
+  // Maps a new slab. Requires mutex_.
+  char* NewSlab();
+
+  void* AllocateLarge(size_t size);
+
+  static void Push(FreeList* list, char* obj) {
+    reinterpret_cast<Header*>(obj)->next_free = list->head;
+    list->head = obj;
+    list->count++;
+  }
+
+  static char* Pop(FreeList* list) {
+    char* obj = list->head;
+    list->head = reinterpret_cast<Header*>(obj)->next_free;
+    list->count--;
+    return obj;
+  }
+
+  SlabAllocatorOptions options_;
+  std::vector<SizeClass> size_classes_;
+  std::unique_ptr<CoreLocalArray<Shard>> shards_;
+
+  // Protects the global free lists and the slabs
+  mutable port::Mutex mutex_;
+  std::vector<MemMapping> slabs_;
+  size_t num_huge_page_slabs_ = 0;
+
+  std::atomic<size_t> large_allocated_bytes_{0};
+};
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -273,6 +273,8 @@ const std::vector<std::pair<Tickers, std::string>> TickersNameMap = {
     {FILE_READ_CORRUPTION_RETRY_SUCCESS_COUNT,
      "rocksdb.file.read.corruption.retry.success.count"},
     {NUMBER_WBWI_INGEST, "rocksdb.number.wbwi.ingest"},
+    {NEGATIVE_LOOKUP_CACHE_HIT, "rocksdb.negative.lookup.cache.hit"},
+    {NEGATIVE_LOOKUP_CACHE_MISS, "rocksdb.negative.lookup.cache.miss"},
 };
 
 const std::vector<std::pair<Histograms, std::string>> HistogramsNameMap = {
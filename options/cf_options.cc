@@ -312,6 +312,22 @@ static std::unordered_map<std::string, OptionTypeInfo>
           OptionType::kUInt64T, OptionVerificationType::kNormal,
           OptionTypeFlags::kMutable}}};
 
+static std::unordered_map<std::string, OptionTypeInfo>
+    hybrid_compaction_options_type_info = {
+        {"size_ratio",
+         {offsetof(struct CompactionOptionsHybrid, size_ratio),
+          OptionType::kInt, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
+        {"max_runs_per_tier",
+         OptionTypeInfo::Vector<int>(
+             offsetof(struct CompactionOptionsHybrid, max_runs_per_tier),
+             OptionVerificationType::kNormal, OptionTypeFlags::kMutable,
+             {0, OptionType::kInt})},
+        {"num_leveled_levels",
+         {offsetof(struct CompactionOptionsHybrid, num_leveled_levels),
+          OptionType::kInt, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}}};
+
 static std::unordered_map<std::string, OptionTypeInfo>
     universal_compaction_options_type_info = {
         {"size_ratio",
@@ -391,6 +407,11 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct MutableCFOptions, paranoid_file_checks),
           OptionType::kBoolean, OptionVerificationType::kNormal,
           OptionTypeFlags::kMutable}},
+        {"range_tombstone_index_for_point_lookups",
+         {offsetof(struct MutableCFOptions,
+                   range_tombstone_index_for_point_lookups),
+          OptionType::kBoolean, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
         {"verify_checksums_in_compaction",
          {0, OptionType::kBoolean, OptionVerificationType::kDeprecated,
           OptionTypeFlags::kMutable}},
@@ -554,6 +575,11 @@ static std::unordered_map<std::string, OptionTypeInfo>
              &universal_compaction_options_type_info,
              offsetof(struct MutableCFOptions, compaction_options_universal),
              OptionVerificationType::kNormal, OptionTypeFlags::kMutable)},
+        {"compaction_options_hybrid",
+         OptionTypeInfo::Struct(
+             "compaction_options_hybrid", &hybrid_compaction_options_type_info,
+             offsetof(struct MutableCFOptions, compaction_options_hybrid),
+             OptionVerificationType::kNormal, OptionTypeFlags::kMutable)},
         {"ttl",
          {offsetof(struct MutableCFOptions, ttl), OptionType::kUInt64T,
           OptionVerificationType::kNormal, OptionTypeFlags::kMutable}},
@@ -609,6 +635,11 @@ static std::unordered_map<std::string, OptionTypeInfo>
                    blob_garbage_collection_force_threshold),
           OptionType::kDouble, OptionVerificationType::kNormal,
           OptionTypeFlags::kMutable}},
+        {"blob_garbage_collection_file_threshold",
+         {offsetof(struct MutableCFOptions,
+                   blob_garbage_collection_file_threshold),
+          OptionType::kDouble, OptionVerificationType::kNormal,
+          OptionTypeFlags::kMutable}},
         {"blob_compaction_readahead_size",
          {offsetof(struct MutableCFOptions, blob_compaction_readahead_size),
           OptionType::kUInt64T, OptionVerificationType::kNormal,
@@ -1096,7 +1127,9 @@ void MutableCFOptions::RefreshDerivedOptions(int num_levels,
                                              CompactionStyle compaction_style) {
   max_file_size.resize(num_levels);
   for (int i = 0; i < num_levels; ++i) {
-    if (i == 0 && compaction_style == kCompactionStyleUniversal) {
+    if (i == 0 && (compaction_style == kCompactionStyleUniversal ||
+                   compaction_style == kCompactionStyleHybrid)) {
+      // Each L0 file is a sorted run of its own.
       max_file_size[i] = ULLONG_MAX;
     } else if (i > 1) {
       max_file_size[i] = MultiplyCheckOverflow(max_file_size[i - 1],
@@ -1187,6 +1220,8 @@ void MutableCFOptions::Dump(Logger* log) const {
                  max_sequential_skip_in_iterations);
   ROCKS_LOG_INFO(log, "                     paranoid_file_checks: %d",
                  paranoid_file_checks);
+  ROCKS_LOG_INFO(log, "  range_tombstone_index_for_point_lookups: %d",
+                 range_tombstone_index_for_point_lookups);
   ROCKS_LOG_INFO(log, "                       report_bg_io_stats: %d",
                  report_bg_io_stats);
   ROCKS_LOG_INFO(log, "                              compression: %d",
@@ -1231,6 +1266,22 @@ void MutableCFOptions::Dump(Logger* log) const {
   ROCKS_LOG_INFO(log, "compaction_options_fifo.allow_compaction : %d",
                  compaction_options_fifo.allow_compaction);
 
+  // Hybrid Compaction Options
+  ROCKS_LOG_INFO(log, "compaction_options_hybrid.size_ratio : %d",
+                 compaction_options_hybrid.size_ratio);
+  result = "";
+  for (const auto m : compaction_options_hybrid.max_runs_per_tier) {
+    snprintf(buf, sizeof(buf), "%d, ", m);
+    result += buf;
+  }
+  if (result.size() >= 2) {
+    result.resize(result.size() - 2);
+  }
+  ROCKS_LOG_INFO(log, "compaction_options_hybrid.max_runs_per_tier : %s",
+                 result.c_str());
+  ROCKS_LOG_INFO(log, "compaction_options_hybrid.num_leveled_levels : %d",
+                 compaction_options_hybrid.num_leveled_levels);
+
   // Blob file related options
   ROCKS_LOG_INFO(log, "                        enable_blob_files: %s",
                  enable_blob_files ? "true" : "false");
@@ -1246,6 +1297,8 @@ void MutableCFOptions::Dump(Logger* log) const {
                  blob_garbage_collection_age_cutoff);
   ROCKS_LOG_INFO(log, "  blob_garbage_collection_force_threshold: %f",
                  blob_garbage_collection_force_threshold);
+  ROCKS_LOG_INFO(log, "   blob_garbage_collection_file_threshold: %f",
+                 blob_garbage_collection_file_threshold);
   ROCKS_LOG_INFO(log, "           blob_compaction_readahead_size: %" PRIu64,
                  blob_compaction_readahead_size);
   ROCKS_LOG_INFO(log, "                 blob_file_starting_level: %d",
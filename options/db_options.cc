@@ -135,6 +135,7 @@ static std::unordered_map<std::string, OptionTypeInfo>
         /*
          // not yet supported
           std::shared_ptr<Cache> row_cache;
+          std::shared_ptr<Cache> negative_lookup_cache;
           std::shared_ptr<DeleteScheduler> delete_scheduler;
           std::shared_ptr<Logger> info_log;
           std::shared_ptr<RateLimiter> rate_limiter;
@@ -595,6 +596,20 @@ static std::unordered_map<std::string, OptionTypeInfo>
          {offsetof(struct ImmutableDBOptions, wal_write_temperature),
           OptionType::kTemperature, OptionVerificationType::kNormal,
           OptionTypeFlags::kNone}},
+        {"compaction_readahead_num_buffers",
+         {offsetof(struct ImmutableDBOptions, compaction_readahead_num_buffers),
+          OptionType::kSizeT, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
+        {"flush_and_compaction_write_num_buffers",
+         {offsetof(struct ImmutableDBOptions,
+                   flush_and_compaction_write_num_buffers),
+          OptionType::kSizeT, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
+        {"block_cache_manifest_period_sec",
+         {offsetof(struct ImmutableDBOptions,
+                   block_cache_manifest_period_sec),
+          OptionType::kUInt64T, OptionVerificationType::kNormal,
+          OptionTypeFlags::kNone}},
 };
 
 const std::string OptionsHelper::kDBOptionsName = "DBOptions";
@@ -770,6 +785,7 @@ ImmutableDBOptions::ImmutableDBOptions(const DBOptions& options)
       wal_recovery_mode(options.wal_recovery_mode),
       allow_2pc(options.allow_2pc),
       row_cache(options.row_cache),
+      negative_lookup_cache(options.negative_lookup_cache),
       wal_filter(options.wal_filter),
       dump_malloc_stats(options.dump_malloc_stats),
       avoid_flush_during_recovery(options.avoid_flush_during_recovery),
@@ -802,7 +818,13 @@ ImmutableDBOptions::ImmutableDBOptions(const DBOptions& options)
       metadata_write_temperature(options.metadata_write_temperature),
       wal_write_temperature(options.wal_write_temperature),
       calculate_sst_write_lifetime_hint_set(
-          options.calculate_sst_write_lifetime_hint_set) {
+          options.calculate_sst_write_lifetime_hint_set),
+      compaction_readahead_num_buffers(
+          options.compaction_readahead_num_buffers),
+      flush_and_compaction_write_num_buffers(
+          options.flush_and_compaction_write_num_buffers),
+      block_cache_manifest_period_sec(
+          options.block_cache_manifest_period_sec) {
   fs = env->GetFileSystem();
   clock = env->GetSystemClock().get();
   logger = info_log.get();
@@ -938,6 +960,15 @@ void ImmutableDBOptions::Dump(Logger* log) const {
     ROCKS_LOG_HEADER(log,
                      "                              Options.row_cache: None");
   }
+  if (negative_lookup_cache) {
+    ROCKS_LOG_HEADER(
+        log,
+        "                  Options.negative_lookup_cache: %" ROCKSDB_PRIszt,
+        negative_lookup_cache->GetCapacity());
+  } else {
+    ROCKS_LOG_HEADER(
+        log, "                  Options.negative_lookup_cache: None");
+  }
   ROCKS_LOG_HEADER(log, "                             Options.wal_filter: %s",
                    wal_filter ? wal_filter->Name() : "None");
 
@@ -988,6 +1019,15 @@ void ImmutableDBOptions::Dump(Logger* log) const {
                    temperature_to_string[metadata_write_temperature].c_str());
   ROCKS_LOG_HEADER(log, "            Options.wal_write_temperature: %s",
                    temperature_to_string[wal_write_temperature].c_str());
+  ROCKS_LOG_HEADER(
+      log, "      Options.compaction_readahead_num_buffers: %" ROCKSDB_PRIszt,
+      compaction_readahead_num_buffers);
+  ROCKS_LOG_HEADER(
+      log, "Options.flush_and_compaction_write_num_buffers: %" ROCKSDB_PRIszt,
+      flush_and_compaction_write_num_buffers);
+  ROCKS_LOG_HEADER(
+      log, "       Options.block_cache_manifest_period_sec: %" PRIu64,
+      block_cache_manifest_period_sec);
 }
 
 bool ImmutableDBOptions::IsWalDirSameAsDBPath() const {
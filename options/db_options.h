@@ -76,6 +76,7 @@ struct ImmutableDBOptions {
   WALRecoveryMode wal_recovery_mode;
   bool allow_2pc;
   std::shared_ptr<Cache> row_cache;
+  std::shared_ptr<Cache> negative_lookup_cache;
   WalFilter* wal_filter;
   bool dump_malloc_stats;
   bool avoid_flush_during_recovery;
@@ -107,6 +108,9 @@ struct ImmutableDBOptions {
   Temperature metadata_write_temperature;
   Temperature wal_write_temperature;
   CompactionStyleSet calculate_sst_write_lifetime_hint_set;
+  size_t compaction_readahead_num_buffers;
+  size_t flush_and_compaction_write_num_buffers;
+  uint64_t block_cache_manifest_period_sec;
 
   // Beginning convenience/helper objects that are not part of the base
   // DBOptions
@@ -77,6 +77,7 @@ AdvancedColumnFamilyOptions::AdvancedColumnFamilyOptions(const Options& options)
       compaction_pri(options.compaction_pri),
       compaction_options_universal(options.compaction_options_universal),
       compaction_options_fifo(options.compaction_options_fifo),
+      compaction_options_hybrid(options.compaction_options_hybrid),
       max_sequential_skip_in_iterations(
           options.max_sequential_skip_in_iterations),
       memtable_factory(options.memtable_factory),
@@ -85,6 +86,8 @@ AdvancedColumnFamilyOptions::AdvancedColumnFamilyOptions(const Options& options)
       max_successive_merges(options.max_successive_merges),
       strict_max_successive_merges(options.strict_max_successive_merges),
       optimize_filters_for_hits(options.optimize_filters_for_hits),
+      range_tombstone_index_for_point_lookups(
+          options.range_tombstone_index_for_point_lookups),
       paranoid_file_checks(options.paranoid_file_checks),
       force_consistency_checks(options.force_consistency_checks),
       report_bg_io_stats(options.report_bg_io_stats),
@@ -107,6 +110,8 @@ AdvancedColumnFamilyOptions::AdvancedColumnFamilyOptions(const Options& options)
           options.blob_garbage_collection_age_cutoff),
       blob_garbage_collection_force_threshold(
           options.blob_garbage_collection_force_threshold),
+      blob_garbage_collection_file_threshold(
+          options.blob_garbage_collection_file_threshold),
       blob_compaction_readahead_size(options.blob_compaction_readahead_size),
       blob_file_starting_level(options.blob_file_starting_level),
       blob_cache(options.blob_cache),
@@ -363,6 +368,11 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
       compaction_options_fifo.max_table_files_size);
   ROCKS_LOG_HEADER(log, "Options.compaction_options_fifo.allow_compaction: %d",
                    compaction_options_fifo.allow_compaction);
+  ROCKS_LOG_HEADER(log, "Options.compaction_options_hybrid.size_ratio: %d",
+                   compaction_options_hybrid.size_ratio);
+  ROCKS_LOG_HEADER(
+      log, "Options.compaction_options_hybrid.num_leveled_levels: %d",
+      compaction_options_hybrid.num_leveled_levels);
   std::ostringstream collector_info;
   for (const auto& collector_factory : table_properties_collector_factories) {
     collector_info << collector_factory->ToString() << ';';
@@ -395,6 +405,9 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
                    strict_max_successive_merges);
   ROCKS_LOG_HEADER(log, "               Options.optimize_filters_for_hits: %d",
                    optimize_filters_for_hits);
+  ROCKS_LOG_HEADER(log,
+                   "Options.range_tombstone_index_for_point_lookups: %d",
+                   range_tombstone_index_for_point_lookups);
   ROCKS_LOG_HEADER(log, "               Options.paranoid_file_checks: %d",
                    paranoid_file_checks);
   ROCKS_LOG_HEADER(log, "               Options.force_consistency_checks: %d",
@@ -439,6 +452,8 @@ void ColumnFamilyOptions::Dump(Logger* log) const {
                    blob_garbage_collection_age_cutoff);
   ROCKS_LOG_HEADER(log, "Options.blob_garbage_collection_force_threshold: %f",
                    blob_garbage_collection_force_threshold);
+  ROCKS_LOG_HEADER(log, " Options.blob_garbage_collection_file_threshold: %f",
+                   blob_garbage_collection_file_threshold);
   ROCKS_LOG_HEADER(log,
                    "         Options.blob_compaction_readahead_size: %" PRIu64,
                    blob_compaction_readahead_size);
@@ -152,6 +152,7 @@ void BuildDBOptions(const ImmutableDBOptions& immutable_db_options,
   options.wal_recovery_mode = immutable_db_options.wal_recovery_mode;
   options.allow_2pc = immutable_db_options.allow_2pc;
   options.row_cache = immutable_db_options.row_cache;
+  options.negative_lookup_cache = immutable_db_options.negative_lookup_cache;
   options.wal_filter = immutable_db_options.wal_filter;
   options.dump_malloc_stats = immutable_db_options.dump_malloc_stats;
   options.avoid_flush_during_recovery =
@@ -199,6 +200,12 @@ void BuildDBOptions(const ImmutableDBOptions& immutable_db_options,
   options.compaction_service = immutable_db_options.compaction_service;
   options.calculate_sst_write_lifetime_hint_set =
       immutable_db_options.calculate_sst_write_lifetime_hint_set;
+  options.compaction_readahead_num_buffers =
+      immutable_db_options.compaction_readahead_num_buffers;
+  options.flush_and_compaction_write_num_buffers =
+      immutable_db_options.flush_and_compaction_write_num_buffers;
+  options.block_cache_manifest_period_sec =
+      immutable_db_options.block_cache_manifest_period_sec;
 }
 
 ColumnFamilyOptions BuildColumnFamilyOptions(
@@ -267,6 +274,7 @@ void UpdateColumnFamilyOptions(const MutableCFOptions& moptions,
 
   cf_opts->compaction_options_fifo = moptions.compaction_options_fifo;
   cf_opts->compaction_options_universal = moptions.compaction_options_universal;
+  cf_opts->compaction_options_hybrid = moptions.compaction_options_hybrid;
 
   // Blob file related options
   cf_opts->enable_blob_files = moptions.enable_blob_files;
@@ -279,6 +287,8 @@ void UpdateColumnFamilyOptions(const MutableCFOptions& moptions,
       moptions.blob_garbage_collection_age_cutoff;
   cf_opts->blob_garbage_collection_force_threshold =
       moptions.blob_garbage_collection_force_threshold;
+  cf_opts->blob_garbage_collection_file_threshold =
+      moptions.blob_garbage_collection_file_threshold;
   cf_opts->blob_compaction_readahead_size =
       moptions.blob_compaction_readahead_size;
   cf_opts->blob_file_starting_level = moptions.blob_file_starting_level;
@@ -288,6 +298,8 @@ void UpdateColumnFamilyOptions(const MutableCFOptions& moptions,
   cf_opts->max_sequential_skip_in_iterations =
       moptions.max_sequential_skip_in_iterations;
   cf_opts->paranoid_file_checks = moptions.paranoid_file_checks;
+  cf_opts->range_tombstone_index_for_point_lookups =
+      moptions.range_tombstone_index_for_point_lookups;
   cf_opts->report_bg_io_stats = moptions.report_bg_io_stats;
   cf_opts->compression = moptions.compression;
   cf_opts->compression_opts = moptions.compression_opts;
@@ -349,7 +361,8 @@ std::map<CompactionStyle, std::string>
         {kCompactionStyleLevel, "kCompactionStyleLevel"},
         {kCompactionStyleUniversal, "kCompactionStyleUniversal"},
         {kCompactionStyleFIFO, "kCompactionStyleFIFO"},
-        {kCompactionStyleNone, "kCompactionStyleNone"}};
+        {kCompactionStyleNone, "kCompactionStyleNone"},
+        {kCompactionStyleHybrid, "kCompactionStyleHybrid"}};
 
 std::map<CompactionPri, std::string> OptionsHelper::compaction_pri_to_string = {
     {kByCompensatedSize, "kByCompensatedSize"},
@@ -819,7 +832,8 @@ std::unordered_map<std::string, CompactionStyle>
         {"kCompactionStyleLevel", kCompactionStyleLevel},
         {"kCompactionStyleUniversal", kCompactionStyleUniversal},
         {"kCompactionStyleFIFO", kCompactionStyleFIFO},
-        {"kCompactionStyleNone", kCompactionStyleNone}};
+        {"kCompactionStyleNone", kCompactionStyleNone},
+        {"kCompactionStyleHybrid", kCompactionStyleHybrid}};
 
 std::unordered_map<std::string, CompactionPri>
     OptionsHelper::compaction_pri_string_map = {
@@ -9,6 +9,9 @@ LIB_SOURCES =                                                   \
   cache/clock_cache.cc                                          \
   cache/lru_cache.cc                                            \
   cache/compressed_secondary_cache.cc                           \
+  cache/frequency_sketch.cc                                     \
+  cache/nvm_secondary_cache.cc                                  \
+  cache/partitioned_cache.cc                                    \
   cache/secondary_cache.cc                                      \
   cache/secondary_cache_adapter.cc                              \
   cache/sharded_cache.cc                                        \
@@ -29,6 +32,7 @@ LIB_SOURCES =                                                   \
   db/blob/blob_log_writer.cc                                    \
   db/blob/blob_source.cc                                        \
   db/blob/prefetch_buffer_collection.cc                         \
+  db/block_cache_manifest.cc                                    \
   db/builder.cc                                                 \
   db/c.cc                                                       \
   db/coalescing_iterator.cc                                     \
@@ -38,6 +42,7 @@ LIB_SOURCES =                                                   \
   db/compaction/compaction_job.cc                               \
   db/compaction/compaction_picker.cc                            \
   db/compaction/compaction_picker_fifo.cc                       \
+  db/compaction/compaction_picker_hybrid.cc                     \
   db/compaction/compaction_picker_level.cc                      \
   db/compaction/compaction_picker_universal.cc                  \
   db/compaction/compaction_service_job.cc                       \
@@ -55,6 +60,7 @@ LIB_SOURCES =                                                   \
   db/db_impl/db_impl_files.cc                                   \
   db/db_impl/db_impl_follower.cc                                \
   db/db_impl/db_impl_open.cc                                    \
+  db/db_impl/db_impl_parallel_scan.cc                           \
   db/db_impl/db_impl_readonly.cc                                \
   db/db_impl/db_impl_secondary.cc                               \
   db/db_impl/db_impl_write.cc                                   \
@@ -80,6 +86,7 @@ LIB_SOURCES =                                                   \
   db/memtable_list.cc                                           \
   db/merge_helper.cc                                            \
   db/merge_operator.cc                                          \
+  db/negative_lookup_cache.cc                                   \
   db/output_validator.cc                                        \
   db/periodic_task_scheduler.cc                                 \
   db/range_del_aggregator.cc                                    \
@@ -137,6 +144,7 @@ LIB_SOURCES =                                                   \
   memory/jemalloc_nodump_allocator.cc                           \
   memory/memkind_kmem_allocator.cc                              \
   memory/memory_allocator.cc                                    \
+  memory/slab_memory_allocator.cc                               \
   memtable/alloc_tracker.cc                                     \
   memtable/hash_linklist_rep.cc                                 \
   memtable/hash_skiplist_rep.cc                                 \
@@ -186,6 +194,7 @@ LIB_SOURCES =                                                   \
   table/block_based/block_cache.cc                              \
   table/block_based/block_prefetcher.cc                         \
   table/block_based/block_prefix_index.cc                       \
+  table/block_based/data_block_back_links.cc                    \
   table/block_based/data_block_hash_index.cc                    \
   table/block_based/data_block_footer.cc                        \
   table/block_based/filter_block_reader_common.cc               \
@@ -453,6 +462,7 @@ TEST_MAIN_SOURCES =                                                     \
   cache/cache_reservation_manager_test.cc                               \
   cache/compressed_secondary_cache_test.cc                              \
   cache/lru_cache_test.cc                                               \
+  cache/nvm_secondary_cache_test.cc                                     \
   cache/tiered_secondary_cache_test.cc					                        \
   db/blob/blob_counting_iterator_test.cc                                \
   db/blob/blob_file_addition_test.cc                                    \
@@ -223,6 +223,10 @@ void DataBlockIter::PrevImpl() {
   assert(prev_entries_idx_ == -1 ||
          static_cast<size_t>(prev_entries_idx_) < prev_entries_.size());
   --cur_entry_idx_;
+  if (back_links_ != nullptr) {
+    PrevWithBackLinks();
+    return;
+  }
   // Check if we can use cached prev_entries_
   if (prev_entries_idx_ > 0 &&
       prev_entries_[prev_entries_idx_].offset == current_) {
@@ -299,6 +303,72 @@ void DataBlockIter::PrevImpl() {
   prev_entries_idx_ = static_cast<int32_t>(prev_entries_.size()) - 1;
 }
 
+void DataBlockIter::PrevWithBackLinks() {
+  const char* limit = data_ + restarts_;
+  // Usually the current entry is the one the previous call moved to, and its
+  // shared key bytes are known
+  if (back_link_idx_ >= back_links_->NumEntries() ||
+      back_links_->EntryOffset(back_link_idx_) != current_) {
+    back_link_idx_ = back_links_->FindEntry(current_);
+    if (back_link_idx_ == back_links_->NumEntries()) {
+      CorruptionError("bad back links in block");
+      return;
+    }
+    uint32_t non_shared, value_length;
+    if (DecodeEntry()(data_ + current_, limit, &back_link_shared_,
+                      &non_shared, &value_length) == nullptr) {
+      CorruptionError();
+      return;
+    }
+  }
+  if (back_link_idx_ == 0) {
+    // No more entries
+    current_ = restarts_;
+    restart_index_ = num_restarts_;
+    return;
+  }
+
+  const uint32_t shared = back_link_shared_;
+  Slice fill;
+  if (!back_links_->GetFill(back_link_idx_, &fill)) {
+    CorruptionError("bad back links in block");
+    return;
+  }
+  --back_link_idx_;
+  const uint32_t prev_offset = back_links_->EntryOffset(back_link_idx_);
+  uint32_t prev_shared, prev_non_shared, prev_value_length;
+  const char* p =
+      prev_offset < current_
+          ? CheckAndDecodeEntry()(data_ + prev_offset, limit, &prev_shared,
+                                  &prev_non_shared, &prev_value_length)
+          : nullptr;
+  // Bytes of the previous key known from the current key and the fill
+  const uint32_t known = shared + static_cast<uint32_t>(fill.size());
+  if (p == nullptr || raw_key_.Size() < shared || known < prev_shared ||
+      known - prev_shared > prev_non_shared) {
+    CorruptionError("bad back links in block");
+    return;
+  }
+
+  if (prev_shared == 0) {
+    // The previous key is stored in full, so can be used from the block
+    raw_key_.SetKey(Slice(p, prev_non_shared), false /* copy */);
+  } else {
+    if (!fill.empty()) {
+      raw_key_.TrimAppend(shared, fill.data(), fill.size());
+    }
+    const uint32_t skip = known - prev_shared;
+    raw_key_.TrimAppend(known, p + skip, prev_non_shared - skip);
+  }
+  back_link_shared_ = prev_shared;
+  current_ = prev_offset;
+  value_ = Slice(p + prev_non_shared, prev_value_length);
+  while (GetRestartPoint(restart_index_) > current_) {
+    assert(restart_index_ > 0);
+    --restart_index_;
+  }
+}
+
 void DataBlockIter::SeekImpl(const Slice& target) {
   Slice seek_key = target;
   PERF_TIMER_GUARD(block_seek_nanos);
@@ -1050,6 +1120,19 @@ BlockBasedTableOptions::DataBlockIndexType Block::IndexType() const {
   return index_type;
 }
 
+bool Block::HasBackLinks() const {
+  assert(size_ >= 2 * sizeof(uint32_t));
+  if (size_ >= kMaxBlockSizeSupportedByBackLinks) {
+    // Like the hash index, back links are only added to smaller blocks
+    return false;
+  }
+  uint32_t block_footer = DecodeFixed32(data_ + size_ - sizeof(uint32_t));
+  bool has_back_links = false;
+  UnPackIndexTypeAndNumRestarts(block_footer, nullptr, nullptr,
+                                &has_back_links);
+  return has_back_links;
+}
+
 Block::~Block() {
   // This sync point can be re-enabled if RocksDB can control the
   // initialization order of any/all static options created by the user.
@@ -1070,8 +1153,14 @@ Block::Block(BlockContents&& contents, size_t read_amp_bytes_per_bit,
   } else {
     // Should only decode restart points for uncompressed blocks
     num_restarts_ = NumRestarts();
+    // The back links, if any, come right after the restart array
+    uint32_t back_links_end = 0;
     switch (IndexType()) {
       case BlockBasedTableOptions::kDataBlockBinarySearch:
+        if (HasBackLinks()) {
+          back_links_end = static_cast<uint32_t>(size_ - sizeof(uint32_t));
+          break;
+        }
         restart_offset_ = static_cast<uint32_t>(size_) -
                           (1 + num_restarts_) * sizeof(uint32_t);
         if (restart_offset_ > size_ - sizeof(uint32_t)) {
@@ -1093,6 +1182,10 @@ Block::Block(BlockContents&& contents, size_t read_amp_bytes_per_bit,
                                                                 NUM_RESTARTS*/
             &map_offset);
 
+        if (HasBackLinks()) {
+          back_links_end = map_offset;
+          break;
+        }
         restart_offset_ = map_offset - num_restarts_ * sizeof(uint32_t);
 
         if (restart_offset_ > map_offset) {
@@ -1105,6 +1198,20 @@ Block::Block(BlockContents&& contents, size_t read_amp_bytes_per_bit,
       default:
         size_ = 0;  // Error marker
     }
+    uint32_t back_links_offset;
+    if (back_links_end == 0) {
+      // No back links
+    } else if (!back_links_.Initialize(data_, back_links_end,
+                                       &back_links_offset)) {
+      size_ = 0;
+    } else {
+      restart_offset_ = back_links_offset - num_restarts_ * sizeof(uint32_t);
+      if (restart_offset_ > back_links_offset) {
+        // back_links_offset is too small for NumRestarts() and therefore
+        // restart_offset_ wrapped around.
+        size_ = 0;
+      }
+    }
   }
   if (read_amp_bytes_per_bit != 0 && statistics && size_ != 0) {
     read_amp_bitmap_.reset(new BlockReadAmpBitmap(
@@ -1279,7 +1386,8 @@ DataBlockIter* Block::NewDataIterator(const Comparator* raw_ucmp,
         read_amp_bitmap_.get(), block_contents_pinned,
         user_defined_timestamps_persisted,
         data_block_hash_index_.Valid() ? &data_block_hash_index_ : nullptr,
-        protection_bytes_per_key_, kv_checksum_, block_restart_interval_);
+        back_links_.Valid() ? &back_links_ : nullptr, protection_bytes_per_key_,
+        kv_checksum_, block_restart_interval_);
     if (read_amp_bitmap_) {
       if (read_amp_bitmap_->GetStatistics() != stats) {
         // DB changed the Statistics pointer, we need to notify read_amp_bitmap_
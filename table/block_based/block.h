@@ -23,6 +23,7 @@
 #include "rocksdb/statistics.h"
 #include "rocksdb/table.h"
 #include "table/block_based/block_prefix_index.h"
+#include "table/block_based/data_block_back_links.h"
 #include "table/block_based/data_block_hash_index.h"
 #include "table/format.h"
 #include "table/internal_iterator.h"
@@ -172,6 +173,9 @@ class Block {
 
   BlockBasedTableOptions::DataBlockIndexType IndexType() const;
 
+  // Whether this is a data block with back links, see data_block_back_links.h
+  bool HasBackLinks() const;
+
   // raw_ucmp is a raw (i.e., not wrapped by `UserComparatorWrapper`) user key
   // comparator.
   //
@@ -288,6 +292,7 @@ class Block {
   uint32_t block_restart_interval_{0};
   uint8_t protection_bytes_per_key_{0};
   DataBlockHashIndex data_block_hash_index_;
+  DataBlockBackLinks back_links_;
 };
 
 // A `BlockIter` iterates over the entries in a `Block`'s data buffer. The
@@ -693,6 +698,7 @@ class DataBlockIter final : public BlockIter<Slice> {
                   bool block_contents_pinned,
                   bool user_defined_timestamps_persisted,
                   DataBlockHashIndex* data_block_hash_index,
+                  DataBlockBackLinks* back_links,
                   uint8_t protection_bytes_per_key, const char* kv_checksum,
                   uint32_t block_restart_interval) {
     InitializeBase(raw_ucmp, data, restarts, num_restarts, global_seqno,
@@ -703,6 +709,9 @@ class DataBlockIter final : public BlockIter<Slice> {
     read_amp_bitmap_ = read_amp_bitmap;
     last_bitmap_offset_ = current_ + 1;
     data_block_hash_index_ = data_block_hash_index;
+    // The back links decode keys as persisted, without padded timestamps
+    back_links_ = pad_min_timestamp_ ? nullptr : back_links;
+    back_link_idx_ = 0;
   }
 
   Slice value() const override {
@@ -780,7 +789,15 @@ class DataBlockIter final : public BlockIter<Slice> {
 
   DataBlockHashIndex* data_block_hash_index_;
 
+  DataBlockBackLinks* back_links_ = nullptr;
+  // Index in back_links_ of the entry PrevImpl() last moved to, and the number
+  // of key bytes it shares with the entry before it
+  uint32_t back_link_idx_ = 0;
+  uint32_t back_link_shared_ = 0;
+
   bool SeekForGetImpl(const Slice& target);
+  // PrevImpl() for blocks with back links
+  void PrevWithBackLinks();
 };
 
 // Iterator over MetaBlocks.  MetaBlocks are similar to Data Blocks and
@@ -307,6 +307,11 @@ struct BlockBasedTableBuilder::Rep {
       compression_dict_buffer_cache_res_mgr;
   const bool use_delta_encoding_for_index_values;
   std::unique_ptr<FilterBlockBuilder> filter_builder;
+  // Builds the range filter (see
+  // BlockBasedTableOptions::range_filter_prefix_lengths), or nullptr
+  std::unique_ptr<FilterBitsBuilder> range_filter_bits_builder;
+  // The last prefix added to the range filter, per prefix length
+  std::vector<std::string> last_range_filter_prefixes;
   OffsetableCacheKey base_cache_key;
   const TableFileCreationReason reason;
 
@@ -426,7 +431,8 @@ struct BlockBasedTableBuilder::Rep {
                        ? BlockBasedTableOptions::kDataBlockBinarySearch
                        : table_options.data_block_index_type,
                    table_options.data_block_hash_table_util_ratio, ts_sz,
-                   persist_user_defined_timestamps),
+                   persist_user_defined_timestamps, false /* is_user_key */,
+                   table_options.data_block_back_links),
         range_del_block(
             1 /* block_restart_interval */, true /* use_delta_encoding */,
             false /* use_value_delta_encoding */,
@@ -594,6 +600,18 @@ struct BlockBasedTableBuilder::Rep {
           use_delta_encoding_for_index_values, p_index_builder_, ts_sz,
           persist_user_defined_timestamps));
     }
+    // Keys within a range sharing a prefix all have that prefix only under
+    // the bytewise orderings
+    const Comparator* ucmp = internal_comparator.user_comparator();
+    if (filter_builder != nullptr &&
+        !table_options.range_filter_prefix_lengths.empty() &&
+        (ucmp == BytewiseComparator() ||
+         ucmp == ReverseBytewiseComparator())) {
+      range_filter_bits_builder.reset(
+          BloomFilterPolicy::GetBuilderFromContext(filter_context));
+      last_range_filter_prefixes.resize(
+          table_options.range_filter_prefix_lengths.size());
+    }
 
     assert(tbo.internal_tbl_prop_coll_factories);
     for (auto& factory : *tbo.internal_tbl_prop_coll_factories) {
@@ -1077,6 +1095,23 @@ void BlockBasedTableBuilder::Add(const Slice& ikey, const Slice& value) {
       }
     }
 
+    if (r->range_filter_bits_builder != nullptr) {
+      const Slice user_key = ExtractUserKey(ikey);
+      const auto& lengths = r->table_options.range_filter_prefix_lengths;
+      for (size_t i = 0; i < lengths.size(); i++) {
+        if (user_key.size() < lengths[i]) {
+          continue;
+        }
+        // Keys are sorted, so equal prefixes are adjacent
+        Slice prefix(user_key.data(), lengths[i]);
+        std::string& last_prefix = r->last_range_filter_prefixes[i];
+        if (prefix != Slice(last_prefix)) {
+          r->range_filter_bits_builder->AddKey(prefix);
+          last_prefix.assign(prefix.data(), prefix.size());
+        }
+      }
+    }
+
     r->data_block.AddWithLastKey(ikey, value, r->last_ikey);
     r->last_ikey.assign(ikey.data(), ikey.size());
     assert(!r->last_ikey.empty());
@@ -1890,6 +1925,34 @@ void BlockBasedTableBuilder::WriteRangeDelBlock(
   }
 }
 
+void BlockBasedTableBuilder::WriteRangeFilterBlock(
+    MetaIndexBuilder* meta_index_builder) {
+  Rep* r = rep_;
+  if (!ok() || r->range_filter_bits_builder == nullptr ||
+      r->range_filter_bits_builder->EstimateEntriesAdded() == 0) {
+    return;
+  }
+  std::unique_ptr<const char[]> filter_owner;
+  Slice filter = r->range_filter_bits_builder->Finish(&filter_owner);
+  // The filter is followed by the prefix lengths it covers, so that readers
+  // do not depend on the current options
+  std::string contents(filter.data(), filter.size());
+  const auto& lengths = r->table_options.range_filter_prefix_lengths;
+  for (size_t len : lengths) {
+    PutFixed32(&contents, static_cast<uint32_t>(len));
+  }
+  PutFixed32(&contents, static_cast<uint32_t>(lengths.size()));
+  r->range_filter_bits_builder.reset();
+
+  // Like the metaindex, kept in table reader memory rather than block cache
+  BlockHandle range_filter_block_handle;
+  WriteMaybeCompressedBlock(contents, kNoCompression,
+                            &range_filter_block_handle, BlockType::kMetaIndex);
+  if (ok()) {
+    meta_index_builder->Add(kRangeFilterBlockName, range_filter_block_handle);
+  }
+}
+
 void BlockBasedTableBuilder::WriteFooter(BlockHandle& metaindex_block_handle,
                                          BlockHandle& index_block_handle) {
   assert(ok());
@@ -2130,15 +2193,17 @@ Status BlockBasedTableBuilder::Finish() {
   //    2. [meta block: index]
   //    3. [meta block: compression dictionary]
   //    4. [meta block: range deletion tombstone]
-  //    5. [meta block: properties]
-  //    6. [metaindex block]
-  //    7. Footer
+  //    5. [meta block: range filter]
+  //    6. [meta block: properties]
+  //    7. [metaindex block]
+  //    8. Footer
   BlockHandle metaindex_block_handle, index_block_handle;
   MetaIndexBuilder meta_index_builder;
   WriteFilterBlock(&meta_index_builder);
   WriteIndexBlock(&meta_index_builder, &index_block_handle);
   WriteCompressionDictBlock(&meta_index_builder);
   WriteRangeDelBlock(&meta_index_builder);
+  WriteRangeFilterBlock(&meta_index_builder);
   WritePropertiesBlock(&meta_index_builder);
   if (ok()) {
     // flush the meta index block
@@ -273,6 +273,9 @@ static struct BlockBasedTableTypeInfo {
          {offsetof(struct BlockBasedTableOptions,
                    data_block_hash_table_util_ratio),
           OptionType::kDouble, OptionVerificationType::kNormal}},
+        {"data_block_back_links",
+         {offsetof(struct BlockBasedTableOptions, data_block_back_links),
+          OptionType::kBoolean, OptionVerificationType::kNormal}},
         {"checksum",
          {offsetof(struct BlockBasedTableOptions, checksum),
           OptionType::kChecksumType, OptionVerificationType::kNormal}},
@@ -315,6 +318,12 @@ static struct BlockBasedTableTypeInfo {
         {"whole_key_filtering",
          {offsetof(struct BlockBasedTableOptions, whole_key_filtering),
           OptionType::kBoolean, OptionVerificationType::kNormal}},
+        {"range_filter_prefix_lengths",
+         OptionTypeInfo::Vector<size_t>(
+             offsetof(struct BlockBasedTableOptions,
+                      range_filter_prefix_lengths),
+             OptionVerificationType::kNormal, OptionTypeFlags::kNone,
+             {0, OptionType::kSizeT})},
         {"detect_filter_construct_corruption",
          {offsetof(struct BlockBasedTableOptions,
                    detect_filter_construct_corruption),
@@ -608,6 +617,12 @@ Status BlockBasedTableFactory::ValidateOptions(
         "Enable pin_l0_filter_and_index_blocks_in_cache, "
         ", but block cache is disabled");
   }
+  for (size_t len : table_options_.range_filter_prefix_lengths) {
+    if (len == 0) {
+      return Status::InvalidArgument(
+          "range_filter_prefix_lengths must be positive");
+    }
+  }
   if (!IsSupportedFormatVersion(table_options_.format_version)) {
     return Status::InvalidArgument(
         "Unsupported BlockBasedTable format_version. Please check "
@@ -768,6 +783,9 @@ std::string BlockBasedTableFactory::GetPrintableOptions() const {
   snprintf(buffer, kBufferSize, "  data_block_hash_table_util_ratio: %lf\n",
            table_options_.data_block_hash_table_util_ratio);
   ret.append(buffer);
+  snprintf(buffer, kBufferSize, "  data_block_back_links: %d\n",
+           table_options_.data_block_back_links);
+  ret.append(buffer);
   snprintf(buffer, kBufferSize, "  checksum: %d\n", table_options_.checksum);
   ret.append(buffer);
   snprintf(buffer, kBufferSize, "  no_block_cache: %d\n",
@@ -8,6 +8,8 @@
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
 #include "table/block_based/block_based_table_iterator.h"
 
+#include <algorithm>
+
 namespace ROCKSDB_NAMESPACE {
 
 void BlockBasedTableIterator::SeekToFirst() { SeekImpl(nullptr, false); }
@@ -83,6 +85,17 @@ void BlockBasedTableIterator::SeekImpl(const Slice* target,
                                             ? LAST_LEVEL_SEEK_FILTER_MATCH
                                             : NON_LAST_LEVEL_SEEK_FILTER_MATCH);
   }
+  if (target && read_options_.iterate_upper_bound != nullptr &&
+      !table_->RangeMayMatch(ExtractUserKey(*target),
+                             *read_options_.iterate_upper_bound)) {
+    // No key in [target, upper bound). Not out of bound, since a later file
+    // of the level may still have keys before the upper bound.
+    ResetDataIter();
+    RecordTick(table_->GetStatistics(), is_last_level_
+                                            ? LAST_LEVEL_SEEK_FILTERED
+                                            : NON_LAST_LEVEL_SEEK_FILTERED);
+    return;
+  }
 
   bool need_seek_index = true;
 
@@ -144,7 +157,8 @@ void BlockBasedTableIterator::SeekImpl(const Slice* target,
   } else {
     // Need to use the data block.
     if (!same_block) {
-      if (read_options_.async_io && async_prefetch) {
+      if (read_options_.async_io && async_prefetch &&
+          prepared_blocks_.find(v.handle.offset()) == prepared_blocks_.end()) {
         AsyncInitDataBlock(/*is_first_pass=*/true);
         if (async_read_in_progress_) {
           // Status::TryAgain indicates asynchronous request for retrieval of
@@ -367,6 +381,10 @@ void BlockBasedTableIterator::InitDataBlock() {
     bool is_for_compaction =
         lookup_context_.caller == TableReaderCaller::kCompaction;
 
+    auto prepared = prepared_blocks_.empty()
+                        ? prepared_blocks_.end()
+                        : prepared_blocks_.find(data_block_handle.offset());
+
     // Initialize Data Block From CacheableEntry.
     if (is_in_cache) {
       Status s;
@@ -374,6 +392,12 @@ void BlockBasedTableIterator::InitDataBlock() {
       table_->NewDataBlockIterator<DataBlockIter>(
           read_options_, (block_handles_->front().cachable_entry_).As<Block>(),
           &block_iter_, s);
+    } else if (prepared != prepared_blocks_.end()) {
+      Status s;
+      block_iter_.Invalidate(Status::OK());
+      table_->NewDataBlockIterator<DataBlockIter>(
+          read_options_, prepared->second.As<Block>(), &block_iter_, s);
+      prepared_blocks_.erase(prepared);
     } else {
       auto* rep = table_->get_rep();
 
@@ -420,6 +444,69 @@ void BlockBasedTableIterator::InitDataBlock() {
   }
 }
 
+void BlockBasedTableIterator::Prepare(
+    const std::vector<ScanOptions>* scan_opts) {
+  prepared_blocks_.clear();
+  if (scan_opts == nullptr || icomp_.user_comparator()->timestamp_size() > 0 ||
+      lookup_context_.caller == TableReaderCaller::kCompaction) {
+    return;
+  }
+  // Bounds the memory pinned when scans cover much of the file
+  constexpr uint64_t kMaxPreparedBytes = uint64_t{64} << 20;
+
+  std::vector<BlockHandle> handles;
+  uint64_t prepared_bytes = 0;
+  IterKey seek_key;
+  for (const ScanOptions& scan : *scan_opts) {
+    if (!scan.range.start.has_value() || prepared_bytes >= kMaxPreparedBytes) {
+      continue;
+    }
+    seek_key.SetInternalKey(scan.range.start.value(), kMaxSequenceNumber,
+                            kValueTypeForSeek);
+    for (index_iter_->Seek(seek_key.GetInternalKey()); index_iter_->Valid();
+         index_iter_->Next()) {
+      const BlockHandle& handle = index_iter_->value().handle;
+      handles.push_back(handle);
+      prepared_bytes += handle.size();
+      // An unbounded scan may stop early, so only its first block is read.
+      // Otherwise the scan ends in the first block whose index key, which is
+      // at least its last key, reaches the limit.
+      if (!scan.range.limit.has_value() ||
+          user_comparator_.CompareWithoutTimestamp(
+              index_iter_->user_key(), /*a_has_ts=*/true,
+              scan.range.limit.value(), /*b_has_ts=*/false) >= 0 ||
+          prepared_bytes >= kMaxPreparedBytes) {
+        break;
+      }
+    }
+  }
+  // index_iter_ no longer matches the data block, so require a seek
+  ResetDataIter();
+  ResetPreviousBlockOffset();
+  ClearBlockHandles();
+  is_index_at_curr_block_ = true;
+  is_at_first_key_from_index_ = false;
+
+  // Adjacent ranges can share blocks
+  auto by_offset = [](const BlockHandle& a, const BlockHandle& b) {
+    return a.offset() < b.offset();
+  };
+  std::sort(handles.begin(), handles.end(), by_offset);
+  handles.erase(std::unique(handles.begin(), handles.end(),
+                            [](const BlockHandle& a, const BlockHandle& b) {
+                              return a.offset() == b.offset();
+                            }),
+                handles.end());
+
+  std::vector<CachableEntry<Block_kData>> blocks;
+  table_->RetrieveDataBlocksForScan(read_options_, handles, &blocks);
+  for (size_t i = 0; i < handles.size(); i++) {
+    if (!blocks[i].IsEmpty()) {
+      prepared_blocks_.emplace(handles[i].offset(), std::move(blocks[i]));
+    }
+  }
+}
+
 void BlockBasedTableIterator::AsyncInitDataBlock(bool is_first_pass) {
   BlockHandle data_block_handle;
   bool is_for_compaction =
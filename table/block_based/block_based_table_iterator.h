@@ -56,6 +56,9 @@ class BlockBasedTableIterator : public InternalIteratorBase<Slice> {
   void Next() final override;
   bool NextAndGetResult(IterateResult* result) override;
   void Prev() override;
+  // Reads the data blocks of all the scan ranges at once, combining reads of
+  // adjacent blocks, so that the scans do not each wait for their own reads.
+  void Prepare(const std::vector<ScanOptions>* scan_opts) override;
   bool Valid() const override {
     return !is_out_of_bound_ &&
            (is_at_first_key_from_index_ ||
@@ -333,6 +336,10 @@ class BlockBasedTableIterator : public InternalIteratorBase<Slice> {
   // size based on cache hit and miss.
   bool readahead_cache_lookup_ = false;
 
+  // Data blocks retrieved by Prepare(), by offset. Each is pinned until its
+  // first use, as blocks are rarely shared by the ranges of a multi-scan.
+  UnorderedMap<uint64_t, CachableEntry<Block_kData>> prepared_blocks_;
+
   // It stores all the block handles that are lookuped in cache ahead when
   // BlockCacheLookupForReadAheadSize is called. Since index_iter_ may point to
   // different blocks when readahead_size is calculated in
@@ -855,6 +855,11 @@ Status BlockBasedTable::Open(
   if (!s.ok()) {
     return s;
   }
+  s = new_table->ReadRangeFilterBlock(ro, prefetch_buffer.get(),
+                                      metaindex_iter.get());
+  if (!s.ok()) {
+    return s;
+  }
   rep->verify_checksum_set_on_open = ro.verify_checksums;
   s = new_table->PrefetchIndexAndFilterBlocks(
       ro, prefetch_buffer.get(), metaindex_iter.get(), new_table.get(),
@@ -1112,6 +1117,70 @@ Status BlockBasedTable::ReadRangeDelBlock(
   return s;
 }
 
+Status BlockBasedTable::ReadRangeFilterBlock(
+    const ReadOptions& read_options, FilePrefetchBuffer* prefetch_buffer,
+    InternalIterator* meta_iter) {
+  const Comparator* ucmp = rep_->internal_comparator.user_comparator();
+  if (rep_->filter_policy == nullptr ||
+      (ucmp != BytewiseComparator() && ucmp != ReverseBytewiseComparator())) {
+    return Status::OK();
+  }
+  BlockHandle range_filter_handle;
+  Status s = FindOptionalMetaBlock(meta_iter, kRangeFilterBlockName,
+                                   &range_filter_handle);
+  if (!s.ok() || range_filter_handle.IsNull()) {
+    return s;
+  }
+  BlockContents contents;
+  s = BlockFetcher(rep_->file.get(), prefetch_buffer, rep_->footer,
+                   read_options, range_filter_handle, &contents,
+                   rep_->ioptions, false /* decompress */,
+                   false /*maybe_compressed*/, BlockType::kMetaIndex,
+                   nullptr /*decompressor*/, rep_->persistent_cache_options,
+                   GetMemoryAllocator(rep_->table_options))
+          .ReadBlockContents();
+  if (!s.ok()) {
+    return s;
+  }
+  // The filter is followed by the fixed32 prefix lengths and their count
+  Slice data = contents.data;
+  uint64_t num_lengths = data.size() >= sizeof(uint32_t)
+                             ? DecodeFixed32(data.data() + data.size() -
+                                             sizeof(uint32_t))
+                             : 0;
+  uint64_t trailer_size = (num_lengths + 1) * sizeof(uint32_t);
+  if (data.size() < trailer_size) {
+    return Status::Corruption("Bad range filter block in " +
+                              rep_->file->file_name());
+  }
+  const char* lengths = data.data() + data.size() - trailer_size;
+  for (uint64_t i = 0; i < num_lengths; i++) {
+    rep_->range_filter_prefix_lengths.push_back(
+        DecodeFixed32(lengths + i * sizeof(uint32_t)));
+  }
+  rep_->range_filter.reset(BuiltinFilterPolicy::GetBuiltinFilterBitsReader(
+      Slice(data.data(), lengths - data.data())));
+  rep_->range_filter_contents = std::move(contents);
+  return s;
+}
+
+bool BlockBasedTable::RangeMayMatch(const Slice& lower_user_key,
+                                    const Slice& upper_bound) const {
+  if (rep_->range_filter == nullptr) {
+    return true;
+  }
+  // Every key in the range starts with the common prefix of its bounds
+  size_t common_prefix_len =
+      lower_user_key.difference_offset(upper_bound);
+  for (size_t len : rep_->range_filter_prefix_lengths) {
+    if (len <= common_prefix_len &&
+        !rep_->range_filter->MayMatch(Slice(lower_user_key.data(), len))) {
+      return false;
+    }
+  }
+  return true;
+}
+
 Status BlockBasedTable::PrefetchIndexAndFilterBlocks(
     const ReadOptions& ro, FilePrefetchBuffer* prefetch_buffer,
     InternalIterator* meta_iter, BlockBasedTable* new_table, bool prefetch_all,
@@ -1301,6 +1370,7 @@ size_t BlockBasedTable::ApproximateMemoryUsage() const {
   if (rep_->uncompression_dict_reader) {
     usage += rep_->uncompression_dict_reader->ApproximateMemoryUsage();
   }
+  usage += rep_->range_filter_contents.ApproximateMemoryUsage();
   if (rep_->table_properties) {
     usage += rep_->table_properties->ApproximateMemoryUsage();
   }
@@ -1418,7 +1488,7 @@ WithBlocklikeCheck<Status, TBlocklike> BlockBasedTable::PutDataBlockToCache(
     BlockContents&& uncompressed_block_contents,
     BlockContents&& compressed_block_contents, CompressionType block_comp_type,
     UnownedPtr<Decompressor> decomp, MemoryAllocator* memory_allocator,
-    GetContext* get_context) const {
+    GetContext* get_context, Cache::Priority priority) const {
   const ImmutableOptions& ioptions = rep_->ioptions;
   assert(out_parsed_block);
   assert(out_parsed_block->IsEmpty());
@@ -1447,7 +1517,7 @@ WithBlocklikeCheck<Status, TBlocklike> BlockBasedTable::PutDataBlockToCache(
     size_t charge = block_holder->ApproximateMemoryUsage();
     BlockCacheTypedHandle<TBlocklike>* cache_handle = nullptr;
     s = block_cache.InsertFull(cache_key, block_holder.get(), charge,
-                               &cache_handle, GetCachePriority<TBlocklike>(),
+                               &cache_handle, priority,
                                rep_->ioptions.lowest_used_cache_tier,
                                compressed_block_contents.data, block_comp_type);
 
@@ -1625,6 +1695,12 @@ BlockBasedTable::MaybeReadBlockAndLoadToCache(
   CacheKey key_data;
   Slice key;
   bool is_cache_hit = false;
+  Cache::Priority priority = GetCachePriority<TBlocklike>();
+  if constexpr (TBlocklike::kBlockType == BlockType::kData) {
+    if (lookup_context && lookup_context->data_block_priority.has_value()) {
+      priority = *lookup_context->data_block_priority;
+    }
+  }
   if (block_cache) {
     // create key for block cache
     key_data = GetCacheKey(rep_->base_cache_key, handle);
@@ -1735,7 +1811,7 @@ BlockBasedTable::MaybeReadBlockAndLoadToCache(
           s = PutDataBlockToCache(
               key, block_cache, out_parsed_block, std::move(uncomp_contents),
               std::move(comp_contents), contents_comp_type, decomp,
-              GetMemoryAllocator(rep_->table_options), get_context);
+              GetMemoryAllocator(rep_->table_options), get_context, priority);
         }
       } else {
         contents_comp_type = GetBlockCompressionType(*contents);
@@ -1751,7 +1827,7 @@ BlockBasedTable::MaybeReadBlockAndLoadToCache(
           s = PutDataBlockToCache(
               key, block_cache, out_parsed_block, std::move(uncomp_contents),
               std::move(comp_contents), contents_comp_type, decomp,
-              GetMemoryAllocator(rep_->table_options), get_context);
+              GetMemoryAllocator(rep_->table_options), get_context, priority);
         }
       }
     }
@@ -1938,6 +2014,166 @@ WithBlocklikeCheck<Status, TBlocklike> BlockBasedTable::RetrieveBlock(
   return s;
 }
 
+void BlockBasedTable::RetrieveDataBlocksForScan(
+    const ReadOptions& ro, const std::vector<BlockHandle>& handles,
+    std::vector<CachableEntry<Block_kData>>* results) const {
+  results->clear();
+  results->resize(handles.size());
+  if (handles.empty() || rep_->ioptions.allow_mmap_reads) {
+    return;
+  }
+  RandomAccessFileReader* file = rep_->file.get();
+
+  CachableEntry<DecompressorDict> dict;
+  if (rep_->uncompression_dict_reader) {
+    Status s =
+        rep_->uncompression_dict_reader->GetOrReadUncompressionDictionary(
+            /*prefetch_buffer=*/nullptr, ro, /*get_context=*/nullptr,
+            /*lookup_context=*/nullptr, &dict);
+    if (!s.ok()) {
+      return;
+    }
+  }
+  UnownedPtr<Decompressor> decomp = dict.GetValue()
+                                        ? dict.GetValue()->decompressor_.get()
+                                        : rep_->decompressor.get();
+
+  // Blocks in the block cache are only pinned
+  const bool use_block_cache = rep_->table_options.block_cache != nullptr;
+  std::vector<size_t> to_read;
+  for (size_t i = 0; i < handles.size(); i++) {
+    assert(i == 0 || handles[i - 1].offset() < handles[i].offset());
+    if (use_block_cache) {
+      LookupAndPinBlocksInCache<Block_kData>(ro, handles[i], &(*results)[i])
+          .PermitUncheckedError();
+    }
+    if ((*results)[i].IsEmpty()) {
+      to_read.push_back(i);
+    }
+  }
+  if (to_read.empty() || ro.read_tier == kBlockCacheTier) {
+    return;
+  }
+
+  // One request per run of adjacent blocks, all sharing one buffer unless
+  // direct IO provides it
+  std::vector<FSReadRequest> read_reqs;
+  std::vector<size_t> req_idx_for_block;
+  std::vector<size_t> req_offset_for_block;
+  size_t total_len = 0;
+  for (size_t i : to_read) {
+    const BlockHandle& handle = handles[i];
+    const size_t len = BlockSizeWithTrailer(handle);
+    if (!read_reqs.empty() && !file->use_direct_io() &&
+        read_reqs.back().offset + read_reqs.back().len == handle.offset()) {
+      req_offset_for_block.push_back(read_reqs.back().len);
+      read_reqs.back().len += len;
+    } else {
+      FSReadRequest req;
+      req.offset = handle.offset();
+      req.len = len;
+      read_reqs.push_back(std::move(req));
+      req_offset_for_block.push_back(0);
+    }
+    req_idx_for_block.push_back(read_reqs.size() - 1);
+    total_len += len;
+    PERF_COUNTER_ADD(block_read_count, 1);
+    PERF_COUNTER_ADD(block_read_byte, len);
+  }
+  std::unique_ptr<char[]> scratch;
+  if (!file->use_direct_io()) {
+    scratch.reset(new char[total_len]);
+    size_t buf_offset = 0;
+    for (FSReadRequest& req : read_reqs) {
+      req.scratch = scratch.get() + buf_offset;
+      buf_offset += req.len;
+    }
+  }
+
+  AlignedBuf direct_io_buf;
+  {
+    IOOptions opts;
+    IODebugContext dbg;
+    IOStatus io_s = file->PrepareIOOptions(ro, opts, &dbg);
+    if (io_s.ok()) {
+      io_s = file->MultiRead(opts, read_reqs.data(), read_reqs.size(),
+                             &direct_io_buf, &dbg);
+    }
+    if (!io_s.ok()) {
+      return;
+    }
+  }
+
+  for (size_t k = 0; k < to_read.size(); k++) {
+    const FSReadRequest& req = read_reqs[req_idx_for_block[k]];
+    if (!req.status.ok() || req.result.size() != req.len) {
+      continue;
+    }
+    LoadReadDataBlock(ro, handles[to_read[k]],
+                      req.result.data() + req_offset_for_block[k], decomp,
+                      &(*results)[to_read[k]]);
+  }
+}
+
+void BlockBasedTable::LoadReadDataBlock(const ReadOptions& ro,
+                                        const BlockHandle& handle,
+                                        const char* data,
+                                        UnownedPtr<Decompressor> decomp,
+                                        CachableEntry<Block_kData>* out) const {
+  const ImmutableOptions& ioptions = rep_->ioptions;
+  MemoryAllocator* memory_allocator = GetMemoryAllocator(rep_->table_options);
+  if (ro.verify_checksums) {
+    PERF_TIMER_GUARD(block_checksum_time);
+    Status s = VerifyBlockChecksum(rep_->footer, data, handle.size(),
+                                   rep_->file->file_name(), handle.offset());
+    RecordTick(ioptions.stats, BLOCK_CHECKSUM_COMPUTE_COUNT);
+    if (!s.ok()) {
+      RecordTick(ioptions.stats, BLOCK_CHECKSUM_MISMATCH_COUNT);
+      return;
+    }
+  }
+
+  // The read buffer does not outlive the caller, so a block that might be
+  // kept as is must be copied
+  BlockContents serialized_block(Slice(data, handle.size()));
+  const CompressionType compression_type =
+      GetBlockCompressionType(serialized_block);
+  if (compression_type == kNoCompression) {
+    Slice serialized(data, BlockSizeWithTrailer(handle));
+    serialized_block = BlockContents(
+        CopyBufferToHeap(memory_allocator, serialized), handle.size());
+  }
+#ifndef NDEBUG
+  serialized_block.has_trailer = true;
+#endif
+
+  if (rep_->table_options.block_cache != nullptr && ro.fill_cache) {
+    Status s = MaybeReadBlockAndLoadToCache(
+        nullptr, ro, handle, decomp, /*for_compaction=*/false, out,
+        /*get_context=*/nullptr, /*lookup_context=*/nullptr, &serialized_block,
+        /*async_read=*/false, /*use_block_cache_for_lookup=*/false);
+    if (!s.ok() || out->GetValue() != nullptr) {
+      return;
+    }
+  }
+
+  BlockContents contents;
+  if (compression_type != kNoCompression) {
+    Status s =
+        DecompressSerializedBlock(data, handle.size(), compression_type,
+                                  *decomp, &contents, ioptions,
+                                  memory_allocator);
+    if (!s.ok()) {
+      return;
+    }
+  } else {
+    contents = std::move(serialized_block);
+  }
+  out->SetOwnedValue(std::make_unique<Block_kData>(
+      std::move(contents), rep_->table_options.read_amp_bytes_per_bit,
+      ioptions.stats));
+}
+
 BlockBasedTable::PartitionedIndexIteratorState::PartitionedIndexIteratorState(
     const BlockBasedTable* table,
     UnorderedMap<uint64_t, CachableEntry<Block>>* block_map)
@@ -2470,16 +2706,232 @@ Status BlockBasedTable::MultiGetFilter(const ReadOptions& read_options,
   return Status::OK();
 }
 
-Status BlockBasedTable::Prefetch(const ReadOptions& read_options,
-                                 const Slice* const begin,
-                                 const Slice* const end) {
+class BlockBasedTable::MultiGetPrefetchImpl
+    : public TableReader::MultiGetPrefetch {
+ public:
+  // A read of adjacent data blocks
+  struct Read {
+    FSReadRequest req;
+    std::vector<BlockHandle> handles;
+    void* io_handle = nullptr;
+    IOHandleDeleter del_fn;
+    bool done = false;
+  };
+
+  MultiGetPrefetchImpl(const BlockBasedTable* table, const ReadOptions& ro)
+      : table_(table), ro_(ro) {}
+
+  ~MultiGetPrefetchImpl() override {
+    std::vector<void*> pending;
+    GetIOHandles(&pending);
+    if (!pending.empty()) {
+      table_->rep_->ioptions.fs->AbortIO(pending).PermitUncheckedError();
+    }
+    for (Read& read : reads_) {
+      if (read.io_handle != nullptr && read.del_fn != nullptr) {
+        read.del_fn(read.io_handle);
+      }
+    }
+  }
+
+  void GetIOHandles(std::vector<void*>* io_handles) const override {
+    for (const Read& read : reads_) {
+      if (!read.done && read.io_handle != nullptr) {
+        io_handles->push_back(read.io_handle);
+      }
+    }
+  }
+
+  void Finish() override {
+    UnownedPtr<Decompressor> decomp =
+        dict_.GetValue() ? dict_.GetValue()->decompressor_.get()
+                         : table_->rep_->decompressor.get();
+    for (Read& read : reads_) {
+      if (!read.done || !read.req.status.ok() ||
+          read.req.result.size() != read.req.len) {
+        continue;
+      }
+      for (const BlockHandle& handle : read.handles) {
+        CachableEntry<Block_kData> block;
+        table_->LoadReadDataBlock(
+            ro_, handle,
+            read.req.result.data() + (handle.offset() - read.req.offset),
+            decomp, &block);
+      }
+    }
+  }
+
+  static void ReadCallback(FSReadRequest& req, void* cb_arg) {
+    Read* read = static_cast<Read*>(cb_arg);
+    read->req.status = req.status;
+    read->req.result = req.result;
+    read->done = true;
+  }
+
+  const BlockBasedTable* const table_;
+  const ReadOptions ro_;
+  CachableEntry<DecompressorDict> dict_;
+  std::unique_ptr<char[]> scratch_;
+  // Not resized once reads are started, as they refer to its elements
+  std::vector<Read> reads_;
+};
+
+std::unique_ptr<TableReader::MultiGetPrefetch>
+BlockBasedTable::StartMultiGetPrefetch(const ReadOptions& read_options,
+                                       const MultiGetRange* mget_range,
+                                       const SliceTransform* prefix_extractor,
+                                       bool skip_filters) {
+  RandomAccessFileReader* file = rep_->file.get();
+  Cache* block_cache = rep_->table_options.block_cache.get();
+  if (mget_range->empty() || block_cache == nullptr ||
+      !read_options.fill_cache || read_options.read_tier == kBlockCacheTier ||
+      rep_->ioptions.allow_mmap_reads || file->use_direct_io()) {
+    return nullptr;
+  }
+
+  // Same filtering as MultiGet(), but without updating the statistics, which
+  // MultiGet() will do when it gets to this table
+  MultiGetRange sst_file_range(*mget_range, mget_range->begin(),
+                               mget_range->end());
+  BlockCacheLookupContext lookup_context{TableReaderCaller::kUserMultiGet};
+  FilterBlockReader* const filter =
+      !skip_filters ? rep_->filter.get() : nullptr;
+  if (filter != nullptr) {
+    if (rep_->whole_key_filtering) {
+      filter->KeysMayMatch(&sst_file_range, &lookup_context, read_options);
+    } else if (!PrefixExtractorChanged(prefix_extractor)) {
+      filter->PrefixesMayMatch(&sst_file_range, prefix_extractor,
+                               &lookup_context, read_options);
+    }
+  }
+  if (sst_file_range.empty()) {
+    return nullptr;
+  }
+
+  bool need_upper_bound_check = false;
+  if (rep_->index_type == BlockBasedTableOptions::kHashSearch) {
+    need_upper_bound_check = PrefixExtractorChanged(prefix_extractor);
+  }
+  IndexBlockIter iiter_on_stack;
+  auto iiter =
+      NewIndexIterator(read_options, need_upper_bound_check, &iiter_on_stack,
+                       /*get_context=*/nullptr, &lookup_context);
+  std::unique_ptr<InternalIteratorBase<IndexValue>> iiter_unique_ptr;
+  if (iiter != &iiter_on_stack) {
+    iiter_unique_ptr.reset(iiter);
+  }
+  // Keys are sorted, so are the blocks
+  std::vector<BlockHandle> handles;
+  for (auto miter = sst_file_range.begin(); miter != sst_file_range.end();
+       ++miter) {
+    iiter->Seek(miter->ikey);
+    if (!iiter->Valid()) {
+      continue;
+    }
+    IndexValue v = iiter->value();
+    if (!v.first_internal_key.empty() && !skip_filters &&
+        UserComparatorWrapper(rep_->internal_comparator.user_comparator())
+                .CompareWithoutTimestamp(
+                    ExtractUserKey(miter->ikey),
+                    ExtractUserKey(v.first_internal_key)) < 0) {
+      continue;
+    }
+    if (!handles.empty() && handles.back().offset() == v.handle.offset()) {
+      continue;
+    }
+    CacheKey key = GetCacheKey(rep_->base_cache_key, v.handle);
+    Cache::Handle* cache_handle = block_cache->Lookup(key.AsSlice());
+    if (cache_handle != nullptr) {
+      block_cache->Release(cache_handle);
+      continue;
+    }
+    handles.push_back(v.handle);
+  }
+  if (handles.empty()) {
+    return nullptr;
+  }
+
+  auto prefetch = std::make_unique<MultiGetPrefetchImpl>(this, read_options);
+  if (rep_->uncompression_dict_reader) {
+    Status s =
+        rep_->uncompression_dict_reader->GetOrReadUncompressionDictionary(
+            /*prefetch_buffer=*/nullptr, read_options, /*get_context=*/nullptr,
+            &lookup_context, &prefetch->dict_);
+    if (!s.ok()) {
+      return nullptr;
+    }
+  }
+  // One read per run of adjacent blocks, all sharing one buffer
+  size_t total_len = 0;
+  for (const BlockHandle& handle : handles) {
+    const size_t len = BlockSizeWithTrailer(handle);
+    if (prefetch->reads_.empty() ||
+        prefetch->reads_.back().req.offset + prefetch->reads_.back().req.len !=
+            handle.offset()) {
+      prefetch->reads_.emplace_back();
+      prefetch->reads_.back().req.offset = handle.offset();
+    }
+    prefetch->reads_.back().req.len += len;
+    prefetch->reads_.back().handles.push_back(handle);
+    total_len += len;
+  }
+  prefetch->scratch_.reset(new char[total_len]);
+
+  IOOptions opts;
+  IODebugContext dbg;
+  IOStatus io_s = file->PrepareIOOptions(read_options, opts, &dbg);
+  size_t buf_offset = 0;
+  bool any_started = false;
+  for (MultiGetPrefetchImpl::Read& read : prefetch->reads_) {
+    if (!io_s.ok()) {
+      break;
+    }
+    read.req.scratch = prefetch->scratch_.get() + buf_offset;
+    buf_offset += read.req.len;
+    io_s = file->ReadAsync(read.req, opts, MultiGetPrefetchImpl::ReadCallback,
+                           &read, &read.io_handle, &read.del_fn,
+                           /*aligned_buf=*/nullptr, &dbg);
+    if (io_s.ok()) {
+      any_started = true;
+      PERF_COUNTER_ADD(block_read_count, read.handles.size());
+      PERF_COUNTER_ADD(block_read_byte, read.req.len);
+    }
+  }
+  if (!any_started) {
+    // E.g. the file system does not support async reads
+    return nullptr;
+  }
+  return prefetch;
+}
+
+Status BlockBasedTable::Prefetch(
+    const ReadOptions& read_options, const Slice* const begin,
+    const Slice* const end, const PrefetchRangeOptions* prefetch_options) {
   auto& comparator = rep_->internal_comparator;
   UserComparatorWrapper user_comparator(comparator.user_comparator());
   // pre-condition
   if (begin && end && comparator.Compare(*begin, *end) > 0) {
     return Status::InvalidArgument(*begin, *end);
   }
+  const PrefetchRangeOptions default_prefetch_options;
+  if (prefetch_options == nullptr) {
+    prefetch_options = &default_prefetch_options;
+  }
   BlockCacheLookupContext lookup_context{TableReaderCaller::kPrefetch};
+  lookup_context.data_block_priority = prefetch_options->data_block_priority;
+
+  // Reads adjacent data blocks that are not cached yet with one I/O
+  std::unique_ptr<FilePrefetchBuffer> prefetch_buffer;
+  if (prefetch_options->readahead_size > 0) {
+    ReadaheadParams readahead_params;
+    readahead_params.initial_readahead_size = prefetch_options->readahead_size;
+    readahead_params.max_readahead_size = prefetch_options->readahead_size;
+    readahead_params.num_buffers = read_options.async_io ? 2 : 1;
+    rep_->CreateFilePrefetchBuffer(readahead_params, &prefetch_buffer,
+                                   /*readaheadsize_cb=*/nullptr,
+                                   FilePrefetchBufferUsage::kUnknown);
+  }
+  IterKey filter_ikey;
   IndexBlockIter iiter_on_stack;
   auto iiter = NewIndexIterator(read_options, /*need_upper_bound_check=*/false,
                                 &iiter_on_stack, /*get_context=*/nullptr,
@@ -2499,7 +2951,6 @@ Status BlockBasedTable::Prefetch(const ReadOptions& read_options,
 
   for (begin ? iiter->Seek(*begin) : iiter->SeekToFirst(); iiter->Valid();
        iiter->Next()) {
-    BlockHandle block_handle = iiter->value().handle;
     const bool is_user_key = !rep_->index_key_includes_seq;
     if (end &&
         ((!is_user_key && comparator.Compare(iiter->key(), *end) >= 0) ||
@@ -2514,24 +2965,105 @@ Status BlockBasedTable::Prefetch(const ReadOptions& read_options,
       prefetching_boundary_page = true;
     }
 
-    // Load the block specified by the block_handle into the block cache
-    DataBlockIter biter;
-    Status tmp_status;
-    NewDataBlockIterator<DataBlockIter>(
-        read_options, block_handle, &biter, /*type=*/BlockType::kData,
-        /*get_context=*/nullptr, &lookup_context,
-        /*prefetch_buffer=*/nullptr, /*for_compaction=*/false,
-        /*async_read=*/false, tmp_status, /*use_block_cache_for_lookup=*/true);
-
-    if (!biter.status().ok()) {
+    Status s = LoadDataBlockIntoCache(read_options, iiter,
+                                      prefetch_buffer.get(), &lookup_context,
+                                      &filter_ikey);
+    if (!s.ok()) {
       // there was an unexpected error while pre-fetching
-      return biter.status();
+      return s;
     }
   }
 
   return Status::OK();
 }
 
+Status BlockBasedTable::LoadDataBlocks(const ReadOptions& read_options,
+                                       const std::vector<uint64_t>& offsets) {
+  assert(std::is_sorted(offsets.begin(), offsets.end()));
+  if (offsets.empty()) {
+    return Status::OK();
+  }
+  BlockCacheLookupContext lookup_context{TableReaderCaller::kPrefetch};
+
+  // Reads nearby blocks with one I/O, like iterator auto readahead
+  std::unique_ptr<FilePrefetchBuffer> prefetch_buffer;
+  const BlockBasedTableOptions& table_options = rep_->table_options;
+  if (table_options.max_auto_readahead_size > 0) {
+    ReadaheadParams readahead_params;
+    readahead_params.initial_readahead_size =
+        std::min(table_options.initial_auto_readahead_size,
+                 table_options.max_auto_readahead_size);
+    readahead_params.max_readahead_size =
+        table_options.max_auto_readahead_size;
+    rep_->CreateFilePrefetchBuffer(readahead_params, &prefetch_buffer,
+                                   /*readaheadsize_cb=*/nullptr,
+                                   FilePrefetchBufferUsage::kUnknown);
+  }
+
+  IterKey filter_ikey;
+  IndexBlockIter iiter_on_stack;
+  auto iiter = NewIndexIterator(read_options, /*need_upper_bound_check=*/false,
+                                &iiter_on_stack, /*get_context=*/nullptr,
+                                &lookup_context);
+  std::unique_ptr<InternalIteratorBase<IndexValue>> iiter_unique_ptr;
+  if (iiter != &iiter_on_stack) {
+    iiter_unique_ptr = std::unique_ptr<InternalIteratorBase<IndexValue>>(iiter);
+  }
+
+  // Merge the offsets with the data blocks listed by the index
+  auto offset_it = offsets.begin();
+  for (iiter->SeekToFirst(); iiter->Valid() && offset_it != offsets.end();
+       iiter->Next()) {
+    const uint64_t block_offset = iiter->value().handle.offset();
+    while (offset_it != offsets.end() && *offset_it < block_offset) {
+      ++offset_it;
+    }
+    if (offset_it == offsets.end() || *offset_it != block_offset) {
+      continue;
+    }
+    Status s = LoadDataBlockIntoCache(read_options, iiter,
+                                      prefetch_buffer.get(), &lookup_context,
+                                      &filter_ikey);
+    if (!s.ok()) {
+      return s;
+    }
+  }
+  return iiter->status();
+}
+
+Status BlockBasedTable::LoadDataBlockIntoCache(
+    const ReadOptions& read_options,
+    InternalIteratorBase<IndexValue>* index_iter,
+    FilePrefetchBuffer* prefetch_buffer,
+    BlockCacheLookupContext* lookup_context, IterKey* filter_ikey) {
+  // Load the filter (partition) covering the block. The result of the
+  // query does not matter.
+  if (rep_->filter) {
+    const size_t ts_sz =
+        rep_->internal_comparator.user_comparator()->timestamp_size();
+    if (!rep_->index_key_includes_seq) {
+      filter_ikey->SetInternalKey(index_iter->key(), kMaxSequenceNumber,
+                                  kValueTypeForSeek);
+    } else {
+      filter_ikey->SetInternalKey(index_iter->key(), /*copy=*/true);
+    }
+    const Slice ikey = filter_ikey->GetInternalKey();
+    rep_->filter->KeyMayMatch(ExtractUserKeyAndStripTimestamp(ikey, ts_sz),
+                              &ikey, /*get_context=*/nullptr, lookup_context,
+                              read_options);
+  }
+
+  // Load the block specified by the block_handle into the block cache
+  DataBlockIter biter;
+  Status tmp_status;
+  NewDataBlockIterator<DataBlockIter>(
+      read_options, index_iter->value().handle, &biter,
+      /*type=*/BlockType::kData, /*get_context=*/nullptr, lookup_context,
+      prefetch_buffer, /*for_compaction=*/false, /*async_read=*/false,
+      tmp_status, /*use_block_cache_for_lookup=*/true);
+  return biter.status();
+}
+
 Status BlockBasedTable::VerifyChecksum(const ReadOptions& read_options,
                                        TableReaderCaller caller) {
   Status s;
@@ -2631,6 +3163,11 @@ BlockType BlockBasedTable::GetBlockTypeForMetaBlockByName(
     return BlockType::kRangeDeletion;
   }
 
+  if (meta_block_name == kRangeFilterBlockName) {
+    // Kept in table reader memory, like the metaindex
+    return BlockType::kMetaIndex;
+  }
+
   if (meta_block_name == kHashIndexPrefixesBlock) {
     return BlockType::kHashIndexPrefixes;
   }
@@ -3037,6 +3574,9 @@ Status BlockBasedTable::DumpTable(WritableFile* out_file) {
       } else if (metaindex_iter->key() == kRangeDelBlockName) {
         out_stream << "  Range deletion block handle: "
                    << metaindex_iter->value().ToString(true) << "\n";
+      } else if (metaindex_iter->key() == kRangeFilterBlockName) {
+        out_stream << "  Range filter block handle: "
+                   << metaindex_iter->value().ToString(true) << "\n";
       }
     }
     out_stream << "\n";
@@ -26,6 +26,7 @@
 #include "table/block_based/block_type.h"
 #include "table/block_based/cachable_entry.h"
 #include "table/block_based/filter_block.h"
+#include "table/block_based/filter_policy_internal.h"
 #include "table/block_based/uncompression_dict_reader.h"
 #include "table/format.h"
 #include "table/persistent_cache_options.h"
@@ -124,6 +125,12 @@ class BlockBasedTable : public TableReader {
                            BlockCacheLookupContext* lookup_context,
                            bool* filter_checked) const;
 
+  // Returns false if the range filter shows that the table has no user key
+  // in [lower_user_key, upper_bound). Returns true if the table has no range
+  // filter, or the two keys share no prefix of a length it covers.
+  bool RangeMayMatch(const Slice& lower_user_key,
+                     const Slice& upper_bound) const;
+
   // Returns a new iterator over the table contents.
   // The result of NewIterator() is initially invalid (caller must
   // call one of the Seek methods on the iterator before using it).
@@ -159,11 +166,22 @@ class BlockBasedTable : public TableReader {
                                   const SliceTransform* prefix_extractor,
                                   bool skip_filters = false);
 
+  // Reads the data blocks missing from the block cache into it. Requires a
+  // block cache and ReadOptions::fill_cache, and a file system supporting
+  // ReadAsync() on a file read without mmap or direct IO.
+  std::unique_ptr<MultiGetPrefetch> StartMultiGetPrefetch(
+      const ReadOptions& read_options, const MultiGetRange* mget_range,
+      const SliceTransform* prefix_extractor, bool skip_filters) override;
+
   // Pre-fetch the disk blocks that correspond to the key range specified by
   // (kbegin, kend). The call will return error status in the event of
   // IO or iteration error.
   Status Prefetch(const ReadOptions& read_options, const Slice* begin,
-                  const Slice* end) override;
+                  const Slice* end,
+                  const PrefetchRangeOptions* prefetch_options) override;
+
+  Status LoadDataBlocks(const ReadOptions& read_options,
+                        const std::vector<uint64_t>& offsets) override;
 
   // Given a key, return an approximate byte offset in the file where
   // the data for that key begins (or would begin if the key were
@@ -299,6 +317,16 @@ class BlockBasedTable : public TableReader {
       const ReadOptions& ro, const BlockHandle& handle,
       CachableEntry<TBlocklike>* out_parsed_block) const;
 
+  // Retrieves the data blocks of `handles`, which must be sorted by offset
+  // without duplicates, for the ranges of a multi-range scan. Blocks missing
+  // from the block cache are read with a single MultiRead, combining reads of
+  // adjacent blocks, and loaded into the block cache per `ro.fill_cache`.
+  // (*results)[i] is left empty if block i could not be retrieved, in which
+  // case a regular read of the block will report the error.
+  void RetrieveDataBlocksForScan(
+      const ReadOptions& ro, const std::vector<BlockHandle>& handles,
+      std::vector<CachableEntry<Block_kData>>* results) const;
+
   struct Rep;
 
   Rep* get_rep() { return rep_; }
@@ -339,8 +367,16 @@ class BlockBasedTable : public TableReader {
  private:
   friend class MockedBlockBasedTable;
   friend class BlockBasedTableReaderTestVerifyChecksum_ChecksumMismatch_Test;
+  class MultiGetPrefetchImpl;
   BlockCacheTracer* const block_cache_tracer_;
 
+  // Verifies and parses a data block read into memory at `data`, as part of a
+  // larger read, and loads it into the block cache per `ro.fill_cache`.
+  // Leaves `out` empty if the block is corrupt.
+  void LoadReadDataBlock(const ReadOptions& ro, const BlockHandle& handle,
+                         const char* data, UnownedPtr<Decompressor> decomp,
+                         CachableEntry<Block_kData>* out) const;
+
   void UpdateCacheHitMetrics(BlockType block_type, GetContext* get_context,
                              size_t usage) const;
   void UpdateCacheMissMetrics(BlockType block_type,
@@ -449,7 +485,8 @@ class BlockBasedTable : public TableReader {
       BlockContents&& uncompressed_block_contents,
       BlockContents&& compressed_block_contents,
       CompressionType block_comp_type, UnownedPtr<Decompressor> decomp,
-      MemoryAllocator* memory_allocator, GetContext* get_context) const;
+      MemoryAllocator* memory_allocator, GetContext* get_context,
+      Cache::Priority priority) const;
 
   // Calls (*handle_result)(arg, ...) repeatedly, starting with the entry found
   // after a call to Seek(key), until handle_result returns false.
@@ -501,6 +538,9 @@ class BlockBasedTable : public TableReader {
                            InternalIterator* meta_iter,
                            const InternalKeyComparator& internal_comparator,
                            BlockCacheLookupContext* lookup_context);
+  Status ReadRangeFilterBlock(const ReadOptions& ro,
+                              FilePrefetchBuffer* prefetch_buffer,
+                              InternalIterator* meta_iter);
   // If index and filter blocks do not need to be pinned, `prefetch_all`
   // determines whether they will be read and add to cache.
   Status PrefetchIndexAndFilterBlocks(
@@ -517,6 +557,14 @@ class BlockBasedTable : public TableReader {
   Status VerifyChecksumInBlocks(const ReadOptions& read_options,
                                 InternalIteratorBase<IndexValue>* index_iter);
 
+  // Loads the data block at the current position of `index_iter`, and the
+  // filter partition covering it, into the block cache.
+  Status LoadDataBlockIntoCache(const ReadOptions& read_options,
+                                InternalIteratorBase<IndexValue>* index_iter,
+                                FilePrefetchBuffer* prefetch_buffer,
+                                BlockCacheLookupContext* lookup_context,
+                                IterKey* filter_ikey);
+
   // Create the filter from the filter block.
   std::unique_ptr<FilterBlockReader> CreateFilterBlockReader(
       const ReadOptions& ro, FilePrefetchBuffer* prefetch_buffer,
@@ -627,6 +675,12 @@ struct BlockBasedTable::Rep {
 
   std::shared_ptr<FragmentedRangeTombstoneList> fragmented_range_dels;
 
+  // The range filter and the prefix lengths it covers, if the file has one.
+  // See BlockBasedTableOptions::range_filter_prefix_lengths.
+  BlockContents range_filter_contents;
+  std::unique_ptr<FilterBitsReader> range_filter;
+  std::vector<size_t> range_filter_prefix_lengths;
+
   // Context for block cache CreateCallback
   BlockCreateContext create_context;
 
@@ -48,7 +48,8 @@ BlockBuilder::BlockBuilder(
     bool use_value_delta_encoding,
     BlockBasedTableOptions::DataBlockIndexType index_type,
     double data_block_hash_table_util_ratio, size_t ts_sz,
-    bool persist_user_defined_timestamps, bool is_user_key)
+    bool persist_user_defined_timestamps, bool is_user_key,
+    bool use_back_links)
     : block_restart_interval_(block_restart_interval),
       use_delta_encoding_(use_delta_encoding),
       use_value_delta_encoding_(use_value_delta_encoding),
@@ -67,6 +68,9 @@ BlockBuilder::BlockBuilder(
     default:
       assert(0);
   }
+  if (use_back_links) {
+    back_links_builder_.Initialize();
+  }
   assert(block_restart_interval_ >= 1);
   estimate_ = sizeof(uint32_t) + sizeof(uint32_t);
 }
@@ -82,6 +86,9 @@ void BlockBuilder::Reset() {
   if (data_block_hash_index_builder_.Valid()) {
     data_block_hash_index_builder_.Reset();
   }
+  if (back_links_builder_.Valid()) {
+    back_links_builder_.Reset();
+  }
 #ifndef NDEBUG
   add_with_last_key_called_ = false;
 #endif
@@ -119,6 +126,9 @@ size_t BlockBuilder::EstimateSizeAfterKV(const Slice& key,
   if (!use_value_delta_encoding_ || (counter_ >= block_restart_interval_)) {
     estimate += VarintLength(value.size());  // varint for value length.
   }
+  if (back_links_builder_.Valid()) {
+    estimate += 2 * sizeof(uint16_t);  // entry offset and fill end.
+  }
 
   return estimate;
 }
@@ -130,6 +140,13 @@ Slice BlockBuilder::Finish() {
   }
 
   uint32_t num_restarts = static_cast<uint32_t>(restarts_.size());
+  // Like the hash index, the back links only support blocks under 64KiB
+  const bool has_back_links =
+      back_links_builder_.Valid() &&
+      CurrentSizeEstimate() < kMaxBlockSizeSupportedByBackLinks;
+  if (has_back_links) {
+    back_links_builder_.Finish(buffer_);
+  }
   BlockBasedTableOptions::DataBlockIndexType index_type =
       BlockBasedTableOptions::kDataBlockBinarySearch;
   if (data_block_hash_index_builder_.Valid() &&
@@ -139,7 +156,8 @@ Slice BlockBuilder::Finish() {
   }
 
   // footer is a packed format of data_block_index_type and num_restarts
-  uint32_t block_footer = PackIndexTypeAndNumRestarts(index_type, num_restarts);
+  uint32_t block_footer =
+      PackIndexTypeAndNumRestarts(index_type, num_restarts, has_back_links);
 
   PutFixed32(&buffer_, block_footer);
   finished_ = true;
@@ -236,6 +254,11 @@ inline void BlockBuilder::AddWithLastKeyImpl(const Slice& key,
     buffer_.append(value.data(), value.size());
   }
 
+  if (back_links_builder_.Valid()) {
+    back_links_builder_.Add(static_cast<uint32_t>(buffer_size), shared,
+                            last_key_persisted);
+  }
+
   // TODO(yuzhangyu): make user defined timestamp work with block hash index.
   if (data_block_hash_index_builder_.Valid()) {
     // Only data blocks should be using `kDataBlockBinaryAndHash` index type.
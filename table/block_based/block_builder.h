@@ -14,6 +14,7 @@
 
 #include "rocksdb/slice.h"
 #include "rocksdb/table.h"
+#include "table/block_based/data_block_back_links.h"
 #include "table/block_based/data_block_hash_index.h"
 
 namespace ROCKSDB_NAMESPACE {
@@ -31,7 +32,7 @@ class BlockBuilder {
                         double data_block_hash_table_util_ratio = 0.75,
                         size_t ts_sz = 0,
                         bool persist_user_defined_timestamps = true,
-                        bool is_user_key = false);
+                        bool is_user_key = false, bool use_back_links = false);
 
   // Reset the contents as if the BlockBuilder was just constructed.
   void Reset();
@@ -69,9 +70,12 @@ class BlockBuilder {
   // Returns an estimate of the current (uncompressed) size of the block
   // we are building.
   inline size_t CurrentSizeEstimate() const {
-    return estimate_ + (data_block_hash_index_builder_.Valid()
-                            ? data_block_hash_index_builder_.EstimateSize()
-                            : 0);
+    return estimate_ +
+           (data_block_hash_index_builder_.Valid()
+                ? data_block_hash_index_builder_.EstimateSize()
+                : 0) +
+           (back_links_builder_.Valid() ? back_links_builder_.EstimateSize()
+                                        : 0);
   }
 
   // Returns an estimated block size after appending key and value.
@@ -120,6 +124,7 @@ class BlockBuilder {
   bool finished_;  // Has Finish() been called?
   std::string last_key_;
   DataBlockHashIndexBuilder data_block_hash_index_builder_;
+  DataBlockBackLinksBuilder back_links_builder_;
 #ifndef NDEBUG
   bool add_with_last_key_called_ = false;
 #endif
@@ -8,6 +8,8 @@
 // found in the LICENSE file. See the AUTHORS file for names of contributors.
 #include "table/block_based/block_prefetcher.h"
 
+#include <algorithm>
+
 #include "rocksdb/file_system.h"
 #include "table/block_based/block_based_table_reader.h"
 
@@ -32,7 +34,13 @@ void BlockPrefetcher::PrefetchIfNeeded(
   const size_t len = BlockBasedTable::BlockSizeWithTrailer(handle);
   const size_t offset = handle.offset();
   if (is_for_compaction) {
-    if (!rep->file->use_direct_io() && compaction_readahead_size_ > 0) {
+    const size_t compaction_readahead_num_buffers =
+        std::max<size_t>(rep->ioptions.compaction_readahead_num_buffers, 1);
+    // With more than one buffer, readahead is issued through ReadAsync by our
+    // own prefetch buffer to keep the next chunks in flight, so the
+    // (synchronous) FileSystem Prefetch() is skipped.
+    if (!rep->file->use_direct_io() && compaction_readahead_size_ > 0 &&
+        compaction_readahead_num_buffers == 1) {
       // If FS supports prefetching (readahead_limit_ will be non zero in that
       // case) and current block exists in prefetch buffer then return.
       if (offset + len <= readahead_limit_) {
@@ -59,6 +67,7 @@ void BlockPrefetcher::PrefetchIfNeeded(
     // implicit_auto_readahead is set.
     readahead_params.initial_readahead_size = compaction_readahead_size_;
     readahead_params.max_readahead_size = compaction_readahead_size_;
+    readahead_params.num_buffers = compaction_readahead_num_buffers;
     rep->CreateFilePrefetchBufferIfNotExists(
         readahead_params, &prefetch_buffer_,
         /*readaheadsize_cb=*/nullptr,
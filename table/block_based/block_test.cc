@@ -286,6 +286,71 @@ TEST_P(BlockTest, IndexHashWithSharedPrefix) {
                      shouldPersistUDT());
 }
 
+TEST_P(BlockTest, BackLinks) {
+  size_t ts_sz = isUDTEnabled() ? 8 : 0;
+  const Comparator *ucmp = isUDTEnabled()
+                               ? test::BytewiseComparatorWithU64TsWrapper()
+                               : BytewiseComparator();
+  std::vector<std::string> keys;
+  std::vector<std::string> values;
+  // Keys of varying shared prefix lengths
+  GenerateRandomKVs(&keys, &values, 0 /* first key id */,
+                    100 /* last key id */, 2 /* step */,
+                    10 /* padding size */, 5 /* keys_share_prefix */, ts_sz);
+
+  BlockBuilder builder(
+      16 /* restart interval */, keyUseDeltaEncoding(),
+      false /* use_value_delta_encoding */,
+      isUDTEnabled() ? BlockBasedTableOptions::kDataBlockBinarySearch
+                     : dataBlockIndexType(),
+      0.75 /* data_block_hash_table_util_ratio */, ts_sz, shouldPersistUDT(),
+      false /* is_user_key */, true /* use_back_links */);
+  for (size_t i = 0; i < keys.size(); i++) {
+    builder.Add(keys[i], values[i]);
+  }
+  BlockContents contents;
+  contents.data = builder.Finish();
+  Block reader(std::move(contents));
+  ASSERT_TRUE(reader.HasBackLinks());
+
+  std::unique_ptr<InternalIterator> iter(reader.NewDataIterator(
+      ucmp, kDisableGlobalSequenceNumber, nullptr /* iter */,
+      nullptr /* stats */, false /* block_contents_pinned */,
+      shouldPersistUDT()));
+  int i = static_cast<int>(keys.size()) - 1;
+  for (iter->SeekToLast(); iter->Valid(); iter->Prev(), i--) {
+    ASSERT_GE(i, 0);
+    ASSERT_EQ(iter->key(), keys[i]);
+    ASSERT_EQ(iter->value(), values[i]);
+  }
+  ASSERT_OK(iter->status());
+  ASSERT_EQ(i, -1);
+
+  // Reverse scans from positions not reached by Prev()
+  Random rnd(301);
+  for (int n = 0; n < 100; n++) {
+    i = static_cast<int>(rnd.Uniform(static_cast<int>(keys.size())));
+    iter->Seek(keys[i]);
+    for (int j = 0; j < 20 && i > 0; j++) {
+      if (rnd.OneIn(4)) {
+        iter->Next();
+        i++;
+        if (i == static_cast<int>(keys.size())) {
+          ASSERT_FALSE(iter->Valid());
+          break;
+        }
+      } else {
+        iter->Prev();
+        i--;
+      }
+      ASSERT_TRUE(iter->Valid());
+      ASSERT_EQ(iter->key(), keys[i]);
+      ASSERT_EQ(iter->value(), values[i]);
+    }
+    ASSERT_OK(iter->status());
+  }
+}
+
 // Param 0: key use delta encoding
 // Param 1: user-defined timestamp test mode
 // Param 2: data block index type. User-defined timestamp feature is not
@@ -0,0 +1,107 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#include "table/block_based/data_block_back_links.h"
+
+#include <algorithm>
+
+#include "util/coding.h"
+
+namespace ROCKSDB_NAMESPACE {
+
+void DataBlockBackLinksBuilder::Add(uint32_t offset, size_t shared,
+                                    const Slice& last_key) {
+  assert(Valid());
+  size_t fill_end = std::max(shared, last_shared_);
+  assert(offsets_.empty() || fill_end <= last_key.size());
+  if (fill_end > shared) {
+    fills_.append(last_key.data() + shared, fill_end - shared);
+  }
+  offsets_.push_back(offset);
+  fill_ends_.push_back(static_cast<uint32_t>(fills_.size()));
+  last_shared_ = shared;
+}
+
+void DataBlockBackLinksBuilder::Finish(std::string& buffer) {
+  assert(Valid());
+  assert(fills_.size() < kMaxBlockSizeSupportedByBackLinks);
+  buffer.append(fills_);
+  for (uint32_t offset : offsets_) {
+    assert(offset < kMaxBlockSizeSupportedByBackLinks);
+    PutFixed16(&buffer, static_cast<uint16_t>(offset));
+  }
+  for (uint32_t fill_end : fill_ends_) {
+    PutFixed16(&buffer, static_cast<uint16_t>(fill_end));
+  }
+  PutFixed16(&buffer, static_cast<uint16_t>(offsets_.size()));
+}
+
+void DataBlockBackLinksBuilder::Reset() {
+  last_shared_ = 0;
+  fills_.clear();
+  offsets_.clear();
+  fill_ends_.clear();
+}
+
+bool DataBlockBackLinks::Initialize(const char* data, uint32_t end,
+                                    uint32_t* links_offset) {
+  num_entries_ = 0;
+  if (end < sizeof(uint16_t)) {
+    return false;
+  }
+  uint32_t num_entries = DecodeFixed16(data + end - sizeof(uint16_t));
+  uint32_t arrays_size = num_entries * 2 * sizeof(uint16_t);
+  if (num_entries == 0 || end - sizeof(uint16_t) < arrays_size) {
+    return false;
+  }
+  fill_ends_ = data + end - sizeof(uint16_t) - num_entries * sizeof(uint16_t);
+  offsets_ = fill_ends_ - num_entries * sizeof(uint16_t);
+  uint32_t fills_size =
+      DecodeFixed16(fill_ends_ + (num_entries - 1) * sizeof(uint16_t));
+  if (static_cast<uint32_t>(offsets_ - data) < fills_size) {
+    return false;
+  }
+  fills_ = offsets_ - fills_size;
+  num_entries_ = num_entries;
+  *links_offset = static_cast<uint32_t>(fills_ - data);
+  return true;
+}
+
+uint32_t DataBlockBackLinks::EntryOffset(uint32_t index) const {
+  assert(index < num_entries_);
+  return DecodeFixed16(offsets_ + index * sizeof(uint16_t));
+}
+
+bool DataBlockBackLinks::GetFill(uint32_t index, Slice* fill) const {
+  assert(index < num_entries_);
+  uint32_t begin =
+      index == 0 ? 0
+                 : DecodeFixed16(fill_ends_ + (index - 1) * sizeof(uint16_t));
+  uint32_t end = DecodeFixed16(fill_ends_ + index * sizeof(uint16_t));
+  if (end < begin || end > static_cast<uint32_t>(offsets_ - fills_)) {
+    return false;
+  }
+  *fill = Slice(fills_ + begin, end - begin);
+  return true;
+}
+
+uint32_t DataBlockBackLinks::FindEntry(uint32_t offset) const {
+  uint32_t left = 0;
+  uint32_t right = num_entries_;
+  while (left < right) {
+    uint32_t mid = left + (right - left) / 2;
+    if (EntryOffset(mid) < offset) {
+      left = mid + 1;
+    } else {
+      right = mid;
+    }
+  }
+  if (left < num_entries_ && EntryOffset(left) == offset) {
+    return left;
+  }
+  return num_entries_;
+}
+
+}  // namespace ROCKSDB_NAMESPACE
@@ -0,0 +1,103 @@
+//  Copyright (c) Meta Platforms, Inc. and affiliates.
+//  This source code is licensed under both the GPLv2 (found in the
+//  COPYING file in the root directory) and Apache 2.0 License
+//  (found in the LICENSE.Apache file in the root directory).
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rocksdb/slice.h"
+
+namespace ROCKSDB_NAMESPACE {
+// Back links let DataBlockIter::Prev() step straight to the previous entry
+// of a data block, instead of decoding its restart interval forward from the
+// restart point. They are only used in data blocks.
+//
+// The back links are appended to the data block, leaving the entries and the
+// restart array as they are:
+//
+// DATA_BLOCK: [RI RI RI ... RI RI_IDX BACK_LINKS HASH_IDX FOOTER]
+//
+// HASH_IDX is optional, see data_block_hash_index.h. The second most
+// significant bit of the FOOTER is the flag indicating the back links are in
+// use. Like the hash index, they use uint16_t offsets, so they are only added
+// to blocks smaller than 64KiB.
+//
+// BACK_LINKS: [FILL FILL ... FILL OFFSET ... OFFSET FILL_END ... FILL_END
+//              NUM_ENTRIES]
+//
+// OFFSET:      The offset of each entry in the block, in key order.
+// FILL_END:    The end offset of each entry's FILL within BACK_LINKS.
+// NUM_ENTRIES: The number of entries of the block.
+//
+// A key is delta encoded against the key before it, so it cannot be decoded
+// from the key after it alone. If entry i shares SHARED(i) bytes with the
+// key before it, that key is
+//
+//   KEY(i)[0, SHARED(i)) + FILL(i) + the rest of the key delta of entry i-1
+//
+// where FILL(i) holds the bytes of KEY(i-1) between SHARED(i) and SHARED(i-1),
+// if any. The key of an entry at a restart point has SHARED(i) = 0, so the
+// key of the last entry in the previous restart interval is decoded the same
+// way.
+
+// Because we use uint16_t offsets, we only support blocks smaller than 64KB
+const size_t kMaxBlockSizeSupportedByBackLinks = 1u << 16;
+
+class DataBlockBackLinksBuilder {
+ public:
+  void Initialize() { valid_ = true; }
+
+  inline bool Valid() const { return valid_; }
+  // Adds the entry at `offset`, which shares `shared` bytes with `last_key`,
+  // the key of the entry added before it (as persisted in the block).
+  void Add(uint32_t offset, size_t shared, const Slice& last_key);
+  void Finish(std::string& buffer);
+  void Reset();
+  inline size_t EstimateSize() const {
+    return fills_.size() + offsets_.size() * 2 * sizeof(uint16_t) +
+           sizeof(uint16_t);
+  }
+
+ private:
+  bool valid_ = false;
+  // Shared key bytes of the entry added last
+  size_t last_shared_ = 0;
+  std::string fills_;
+  std::vector<uint32_t> offsets_;
+  std::vector<uint32_t> fill_ends_;
+};
+
+class DataBlockBackLinks {
+ public:
+  // Parses the back links ending at offset `end` of the block `data`, and
+  // sets `*links_offset` to where they start. Returns false if they are
+  // corrupted.
+  bool Initialize(const char* data, uint32_t end, uint32_t* links_offset);
+
+  inline bool Valid() const { return num_entries_ != 0; }
+
+  uint32_t NumEntries() const { return num_entries_; }
+
+  // Offset of entry `index` in the block
+  uint32_t EntryOffset(uint32_t index) const;
+
+  // Sets `*fill` to the FILL of entry `index`, see above. Returns false if it
+  // is corrupted.
+  bool GetFill(uint32_t index, Slice* fill) const;
+
+  // Returns the index of the entry at `offset` in the block, or NumEntries()
+  // if no entry starts there.
+  uint32_t FindEntry(uint32_t offset) const;
+
+ private:
+  const char* fills_ = nullptr;
+  const char* offsets_ = nullptr;
+  const char* fill_ends_ = nullptr;
+  uint32_t num_entries_ = 0;
+};
+
+}  // namespace ROCKSDB_NAMESPACE
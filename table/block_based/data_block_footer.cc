@@ -21,9 +21,13 @@ const uint32_t kMaxNumRestarts = (1u << kDataBlockIndexTypeBitShift) - 1u;
 // 0x7FFFFFFF
 const uint32_t kNumRestartsMask = (1u << kDataBlockIndexTypeBitShift) - 1u;
 
+// Blocks with back links are smaller than 64KiB, so the next bit is never
+// part of their num_restarts either
+const int kDataBlockBackLinksBitShift = 30;
+
 uint32_t PackIndexTypeAndNumRestarts(
     BlockBasedTableOptions::DataBlockIndexType index_type,
-    uint32_t num_restarts) {
+    uint32_t num_restarts, bool has_back_links) {
   if (num_restarts > kMaxNumRestarts) {
     assert(0);  // mute travis "unused" warning
   }
@@ -34,6 +38,10 @@ uint32_t PackIndexTypeAndNumRestarts(
   } else if (index_type != BlockBasedTableOptions::kDataBlockBinarySearch) {
     assert(0);
   }
+  if (has_back_links) {
+    assert(num_restarts < 1u << kDataBlockBackLinksBitShift);
+    block_footer |= 1u << kDataBlockBackLinksBitShift;
+  }
 
   return block_footer;
 }
@@ -41,7 +49,12 @@ uint32_t PackIndexTypeAndNumRestarts(
 void UnPackIndexTypeAndNumRestarts(
     uint32_t block_footer,
     BlockBasedTableOptions::DataBlockIndexType* index_type,
-    uint32_t* num_restarts) {
+    uint32_t* num_restarts, bool* has_back_links) {
+  if (has_back_links) {
+    *has_back_links = block_footer & 1u << kDataBlockBackLinksBitShift;
+  }
+  block_footer &= ~(1u << kDataBlockBackLinksBitShift);
+
   if (index_type) {
     if (block_footer & 1u << kDataBlockIndexTypeBitShift) {
       *index_type = BlockBasedTableOptions::kDataBlockBinaryAndHash;
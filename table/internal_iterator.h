@@ -93,6 +93,13 @@ class InternalIteratorBase : public Cleanable {
     return is_valid;
   }
 
+  // Same as Seek(target), for a target after the current position. Iterators
+  // composed of child iterators can implement it more cheaply by only moving
+  // the children that are positioned before target, which is much cheaper
+  // than Seek() when only a few of them hold the skipped entries.
+  // REQUIRES: Valid() and key() < target
+  virtual void SeekForward(const Slice& target) { Seek(target); }
+
   // Moves to the previous entry in the source.  After this call, Valid() is
   // true iff the iterator was not positioned at the first entry in source.
   // REQUIRES: Valid()
@@ -30,6 +30,19 @@ Status Iterator::GetProperty(std::string prop_name, std::string* prop) {
   return Status::InvalidArgument("Unidentified property.");
 }
 
+void Iterator::NextBatch(size_t max_entries, size_t max_bytes,
+                         IteratorBatch* batch) {
+  batch->Clear();
+  while (Valid() && batch->size() < max_entries &&
+         batch->data_size() < max_bytes) {
+    if (!PrepareValue()) {
+      break;
+    }
+    batch->Add(key(), value());
+    Next();
+  }
+}
+
 namespace {
 class EmptyIterator : public Iterator {
  public:
@@ -137,6 +137,11 @@ class IteratorWrapperBase {
     iter_->Seek(k);
     Update();
   }
+  void SeekForward(const Slice& k) {
+    assert(iter_);
+    iter_->SeekForward(k);
+    Update();
+  }
   void SeekForPrev(const Slice& k) {
     assert(iter_);
     iter_->SeekForPrev(k);
@@ -382,6 +382,33 @@ class MergingIterator : public InternalIterator {
     current_ = CurrentForward();
   }
 
+  // Only advances the children that are positioned before target, which is
+  // cheaper than Seek() when the skipped entries, e.g. old versions of a user
+  // key, come from a few children.
+  void SeekForward(const Slice& target) override {
+    assert(Valid());
+    if (direction_ != kForward) {
+      Seek(target);
+      return;
+    }
+    // Same as Next(), except that current_ is moved to target. Children are
+    // only ever moved forward, so invariants (1)-(4) hold after each round
+    // just as they do after Next().
+    while (Valid() && comparator_->Compare(key(), target) < 0) {
+      assert(current_ == CurrentForward());
+      current_->SeekForward(target);
+      if (current_->Valid()) {
+        assert(current_->status().ok());
+        minHeap_.replace_top(minHeap_.top());
+      } else {
+        considerStatus(current_->status());
+        minHeap_.pop();
+      }
+      FindNextVisibleKey();
+      current_ = CurrentForward();
+    }
+  }
+
   bool NextAndGetResult(IterateResult* result) override {
     Next();
     bool is_valid = Valid();
@@ -568,7 +595,9 @@ class MergingIterator : public InternalIterator {
     const InternalKeyComparator* comparator_;
   };
 
-  using MergerMinIterHeap = BinaryHeap<HeapItem*, MinHeapItemComparator>;
+  // Forward scans replace the top on every Next(), which the tournament tree
+  // does in at most logN comparisons, or one if the top stays on top
+  using MergerMinIterHeap = TournamentTree<HeapItem*, MinHeapItemComparator>;
   using MergerMaxIterHeap = BinaryHeap<HeapItem*, MaxHeapItemComparator>;
 
   friend class MergeIteratorBuilder;
@@ -651,8 +680,8 @@ class MergingIterator : public InternalIterator {
   IteratorWrapper* current_;
   // If any of the children have non-ok status, this is one of them.
   Status status_;
-  // Invariant: min heap property is maintained (parent is always <= child).
-  // This holds by using only BinaryHeap APIs to modify heap. One
+  // Invariant: min heap property is maintained (minHeap_.top() is <= all).
+  // This holds by using only TournamentTree APIs to modify heap. One
   // exception is to modify heap top item directly (by caller iter->Next()), and
   // it should be followed by a call to replace_top() or pop().
   MergerMinIterHeap minHeap_;
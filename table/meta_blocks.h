@@ -37,6 +37,7 @@ extern const std::string kIndexBlockName;
 extern const std::string kPropertiesBlockOldName;
 extern const std::string kCompressionDictBlockName;
 extern const std::string kRangeDelBlockName;
+extern const std::string kRangeFilterBlockName;
 
 class MetaIndexBuilder {
  public:
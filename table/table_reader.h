@@ -9,6 +9,7 @@
 
 #pragma once
 #include <memory>
+#include <vector>
 
 #include "db/range_tombstone_fragmenter.h"
 #if USE_COROUTINES
@@ -25,6 +26,7 @@ namespace ROCKSDB_NAMESPACE {
 
 class Iterator;
 struct ParsedInternalKey;
+struct PrefetchRangeOptions;
 class Slice;
 class Arena;
 struct ReadOptions;
@@ -156,6 +158,32 @@ class TableReader {
     }
   }
 
+  // Asynchronous reads started by StartMultiGetPrefetch()
+  class MultiGetPrefetch {
+   public:
+    // Aborts the reads that have not completed
+    virtual ~MultiGetPrefetch() {}
+
+    // Appends the handles of the reads, to be waited on with
+    // FileSystem::Poll()
+    virtual void GetIOHandles(std::vector<void*>* io_handles) const = 0;
+
+    // Makes use of the completed reads, e.g. by adding them to the block
+    // cache. Reads that have not completed are ignored.
+    virtual void Finish() = 0;
+  };
+
+  // Starts asynchronous reads of the blocks that a MultiGet() of mget_range
+  // would read from this table after consulting the filter and index, so that
+  // the reads for several tables can be waited on together. Returns nullptr
+  // if there is nothing to read or this is not supported.
+  virtual std::unique_ptr<MultiGetPrefetch> StartMultiGetPrefetch(
+      const ReadOptions& /*readOptions*/,
+      const MultiGetContext::Range* /*mget_range*/,
+      const SliceTransform* /*prefix_extractor*/, bool /*skip_filters*/) {
+    return nullptr;
+  }
+
 #if USE_COROUTINES
   virtual folly::coro::Task<void> MultiGetCoroutine(
       const ReadOptions& readOptions, const MultiGetContext::Range* mget_range,
@@ -168,9 +196,12 @@ class TableReader {
   // Prefetch data corresponding to a give range of keys
   // Typically this functionality is required for table implementations that
   // persists the data on a non volatile storage medium like disk/SSD
-  virtual Status Prefetch(const ReadOptions& /* read_options */,
-                          const Slice* begin = nullptr,
-                          const Slice* end = nullptr) {
+  // `prefetch_options` tunes how the blocks are read and cached; nullptr means
+  // the defaults.
+  virtual Status Prefetch(
+      const ReadOptions& /* read_options */, const Slice* begin = nullptr,
+      const Slice* end = nullptr,
+      const PrefetchRangeOptions* /* prefetch_options */ = nullptr) {
     (void)begin;
     (void)end;
     // Default implementation is NOOP.
@@ -178,6 +209,17 @@ class TableReader {
     return Status::OK();
   }
 
+  // Loads the data blocks starting at the given file offsets, sorted in
+  // ascending order, into the block cache along with the index and filter
+  // partitions covering them. Offsets that do not start a data block are
+  // ignored. Used to warm the block cache from a list of previously cached
+  // blocks.
+  virtual Status LoadDataBlocks(const ReadOptions& /* read_options */,
+                                const std::vector<uint64_t>& /* offsets */) {
+    // Default implementation is NOOP.
+    return Status::OK();
+  }
+
   // convert db file to a human readable form
   virtual Status DumpTable(WritableFile* /*out_file*/) {
     return Status::NotSupported("DumpTable() not supported");
@@ -287,6 +287,10 @@ DEFINE_int64(reads, -1,
              "Number of read operations to do.  "
              "If negative, do FLAGS_num reads.");
 
+DEFINE_int64(iterator_next_batch_size, 0,
+             "If positive, readseq reads this many entries at a time with "
+             "Iterator::NextBatch() instead of calling Next() for each");
+
 DEFINE_int64(deletes, -1,
              "Number of delete operations to do.  "
              "If negative, do FLAGS_num deletions.");
@@ -543,6 +547,15 @@ DEFINE_int32(universal_max_read_amp, -1,
 DEFINE_bool(universal_allow_trivial_move, false,
             "Allow trivial move in universal compaction.");
 
+DEFINE_int32(hybrid_size_ratio,
+             ROCKSDB_NAMESPACE::CompactionOptionsHybrid().size_ratio,
+             "Size ratio between tiers (for hybrid compaction only).");
+
+DEFINE_int32(hybrid_num_leveled_levels,
+             ROCKSDB_NAMESPACE::CompactionOptionsHybrid().num_leveled_levels,
+             "Number of leveled levels at the bottom of the LSM-tree "
+             "(for hybrid compaction only).");
+
 DEFINE_bool(universal_incremental, false,
             "Enable incremental compactions in universal compaction.");
 
@@ -634,6 +647,9 @@ DEFINE_bool(use_cache_jemalloc_no_dump_allocator, false,
 DEFINE_bool(use_cache_memkind_kmem_allocator, false,
             "Use memkind kmem allocator for block/blob cache.");
 
+DEFINE_bool(use_cache_slab_allocator, false,
+            "Use the huge page backed slab allocator for block/blob cache.");
+
 DEFINE_bool(
     decouple_partitioned_filters,
     ROCKSDB_NAMESPACE::BlockBasedTableOptions().decouple_partitioned_filters,
@@ -726,6 +742,10 @@ DEFINE_double(data_block_hash_table_util_ratio, 0.75,
               "This is only valid if use_data_block_hash_index is "
               "set to true");
 
+DEFINE_bool(data_block_back_links, false,
+            "Sets BlockBasedTableOptions::data_block_back_links, for faster "
+            "reverse iteration");
+
 DEFINE_int64(compressed_cache_size, -1,
              "Number of bytes to use as a cache of compressed data.");
 
@@ -746,8 +766,19 @@ DEFINE_uint64(compaction_readahead_size,
               ROCKSDB_NAMESPACE::Options().compaction_readahead_size,
               "Compaction readahead size");
 
+DEFINE_uint64(compaction_readahead_num_buffers,
+              ROCKSDB_NAMESPACE::Options().compaction_readahead_num_buffers,
+              "Number of readahead buffers per compaction input file. Values "
+              "greater than 1 issue readahead asynchronously.");
+
 DEFINE_int32(log_readahead_size, 0, "WAL and manifest readahead size");
 
+DEFINE_uint64(
+    flush_and_compaction_write_num_buffers,
+    ROCKSDB_NAMESPACE::Options().flush_and_compaction_write_num_buffers,
+    "Number of write buffers per SST file written by flush and compaction "
+    "with direct I/O. Values greater than 1 write asynchronously.");
+
 DEFINE_int32(writable_file_max_buffer_size, 1024 * 1024,
              "Maximum write buffer for Writable File");
 
@@ -1095,6 +1126,13 @@ DEFINE_double(blob_garbage_collection_force_threshold,
               "[Integrated BlobDB] The threshold for the ratio of garbage in "
               "the eligible blob files for forcing garbage collection.");
 
+DEFINE_double(blob_garbage_collection_file_threshold,
+              ROCKSDB_NAMESPACE::AdvancedColumnFamilyOptions()
+                  .blob_garbage_collection_file_threshold,
+              "[Integrated BlobDB] The garbage ratio threshold of an "
+              "individual blob file for garbage collecting it regardless of "
+              "its age.");
+
 DEFINE_uint64(blob_compaction_readahead_size,
               ROCKSDB_NAMESPACE::AdvancedColumnFamilyOptions()
                   .blob_compaction_readahead_size,
@@ -1200,6 +1238,10 @@ DEFINE_bool(optimize_multiget_for_io, true,
             "When set true, RocksDB does asynchronous reads for SST files in "
             "multiple levels for MultiGet.");
 
+DEFINE_bool(speculative_multiget_reads, false,
+            "When set true, MultiGet reads data blocks in all levels that "
+            "might hold its keys in parallel before looking the keys up.");
+
 DEFINE_bool(charge_compression_dictionary_building_buffer, false,
             "Setting for "
             "CacheEntryRoleOptions::charged of "
@@ -3084,6 +3126,12 @@ class Benchmark {
       fprintf(stderr, "Memkind library is not linked with the binary.\n");
       exit(1);
 #endif
+    } else if (FLAGS_use_cache_slab_allocator) {
+      SlabAllocatorOptions slab_options;
+      if (!NewSlabMemoryAllocator(slab_options, &allocator).ok()) {
+        fprintf(stderr, "Failed to create slab allocator.\n");
+        exit(1);
+      }
     }
 
     return allocator;
@@ -3491,6 +3539,8 @@ class Benchmark {
       read_options_.adaptive_readahead = FLAGS_adaptive_readahead;
       read_options_.async_io = FLAGS_async_io;
       read_options_.optimize_multiget_for_io = FLAGS_optimize_multiget_for_io;
+      read_options_.speculative_multiget_reads =
+          FLAGS_speculative_multiget_reads;
       read_options_.auto_readahead_size = FLAGS_auto_readahead_size;
       read_options_.auto_refresh_iterator_with_snapshot =
           FLAGS_auto_refresh_iterator_with_snapshot;
@@ -4305,8 +4355,12 @@ class Benchmark {
     options.bloom_locality = FLAGS_bloom_locality;
     options.max_file_opening_threads = FLAGS_file_opening_threads;
     options.compaction_readahead_size = FLAGS_compaction_readahead_size;
+    options.compaction_readahead_num_buffers =
+        static_cast<size_t>(FLAGS_compaction_readahead_num_buffers);
     options.log_readahead_size = FLAGS_log_readahead_size;
     options.writable_file_max_buffer_size = FLAGS_writable_file_max_buffer_size;
+    options.flush_and_compaction_write_num_buffers =
+        static_cast<size_t>(FLAGS_flush_and_compaction_write_num_buffers);
     options.use_fsync = FLAGS_use_fsync;
     options.num_levels = FLAGS_num_levels;
     options.target_file_size_base = FLAGS_target_file_size_base;
@@ -4510,6 +4564,7 @@ class Benchmark {
       }
       block_based_options.data_block_hash_table_util_ratio =
           FLAGS_data_block_hash_table_util_ratio;
+      block_based_options.data_block_back_links = FLAGS_data_block_back_links;
       if (FLAGS_read_cache_path != "") {
         Status rc_status;
 
@@ -4707,6 +4762,9 @@ class Benchmark {
         FLAGS_universal_incremental;
     options.compaction_options_universal.stop_style =
         static_cast<CompactionStopStyle>(FLAGS_universal_stop_style);
+    options.compaction_options_hybrid.size_ratio = FLAGS_hybrid_size_ratio;
+    options.compaction_options_hybrid.num_leveled_levels =
+        FLAGS_hybrid_num_leveled_levels;
     if (FLAGS_thread_status_per_interval > 0) {
       options.enable_thread_tracking = true;
     }
@@ -4736,6 +4794,8 @@ class Benchmark {
         FLAGS_blob_garbage_collection_age_cutoff;
     options.blob_garbage_collection_force_threshold =
         FLAGS_blob_garbage_collection_force_threshold;
+    options.blob_garbage_collection_file_threshold =
+        FLAGS_blob_garbage_collection_file_threshold;
     options.blob_compaction_readahead_size =
         FLAGS_blob_compaction_readahead_size;
     options.blob_file_starting_level = FLAGS_blob_file_starting_level;
@@ -5912,16 +5972,36 @@ class Benchmark {
     Iterator* iter = db->NewIterator(options);
     int64_t i = 0;
     int64_t bytes = 0;
-    for (iter->SeekToFirst(); i < reads_ && iter->Valid(); iter->Next()) {
-      bytes += iter->key().size() + iter->value().size();
-      thread->stats.FinishedOps(nullptr, db, 1, kRead);
-      ++i;
+    if (FLAGS_iterator_next_batch_size > 0) {
+      IteratorBatch batch;
+      iter->SeekToFirst();
+      while (i < reads_ && iter->Valid()) {
+        iter->NextBatch(static_cast<size_t>(std::min<int64_t>(
+                            FLAGS_iterator_next_batch_size, reads_ - i)),
+                        std::numeric_limits<size_t>::max(), &batch);
+        bytes += batch.data_size();
+        thread->stats.FinishedOps(nullptr, db, batch.size(), kRead);
+        const int64_t prev_i = i;
+        i += batch.size();
+        if (thread->shared->read_rate_limiter.get() != nullptr &&
+            i / 1024 != prev_i / 1024) {
+          thread->shared->read_rate_limiter->Request(
+              1024, Env::IO_HIGH, nullptr /* stats */,
+              RateLimiter::OpType::kRead);
+        }
+      }
+    } else {
+      for (iter->SeekToFirst(); i < reads_ && iter->Valid(); iter->Next()) {
+        bytes += iter->key().size() + iter->value().size();
+        thread->stats.FinishedOps(nullptr, db, 1, kRead);
+        ++i;
 
-      if (thread->shared->read_rate_limiter.get() != nullptr &&
-          i % 1024 == 1023) {
-        thread->shared->read_rate_limiter->Request(1024, Env::IO_HIGH,
-                                                   nullptr /* stats */,
-                                                   RateLimiter::OpType::kRead);
+        if (thread->shared->read_rate_limiter.get() != nullptr &&
+            i % 1024 == 1023) {
+          thread->shared->read_rate_limiter->Request(
+              1024, Env::IO_HIGH, nullptr /* stats */,
+              RateLimiter::OpType::kRead);
+        }
       }
     }
 
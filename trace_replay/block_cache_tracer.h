@@ -7,8 +7,10 @@
 
 #include <atomic>
 #include <fstream>
+#include <optional>
 
 #include "monitoring/instrumented_mutex.h"
+#include "rocksdb/advanced_cache.h"
 #include "rocksdb/block_cache_trace_writer.h"
 #include "rocksdb/options.h"
 #include "rocksdb/table_reader_caller.h"
@@ -89,6 +91,9 @@ struct BlockCacheLookupContext {
   uint64_t get_id = 0;
   std::string referenced_key;
   bool get_from_user_specified_snapshot = false;
+  // If set, data blocks read into the block cache on behalf of this lookup
+  // are inserted with this priority rather than the default one.
+  std::optional<Cache::Priority> data_block_priority;
 
   void FillLookupContext(bool _is_cache_hit, bool _no_insert,
                          TraceType _block_type, uint64_t _block_size,
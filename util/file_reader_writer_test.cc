@@ -228,6 +228,142 @@ TEST_F(WritableFileWriterTest, IncrementalBuffer) {
   }
 }
 
+TEST_F(WritableFileWriterTest, AsyncDirectWrites) {
+  // Asynchronous writes are only completed when the FileSystem is polled
+  struct PendingWrite {
+    Slice data;
+    uint64_t offset;
+    std::function<void(const IOStatus&, void*)> cb;
+    void* cb_arg;
+  };
+
+  class FakeWF : public FSWritableFile {
+   public:
+    explicit FakeWF(std::string* _file_data) : file_data_(_file_data) {}
+    ~FakeWF() override = default;
+
+    using FSWritableFile::Append;
+    IOStatus Append(const Slice& /*data*/, const IOOptions& /*options*/,
+                    IODebugContext* /*dbg*/) override {
+      return IOStatus::NotSupported();
+    }
+    using FSWritableFile::PositionedAppend;
+    IOStatus PositionedAppend(const Slice& data, uint64_t pos,
+                              const IOOptions& /*options*/,
+                              IODebugContext* /*dbg*/) override {
+      EXPECT_TRUE(pos % 512 == 0);
+      EXPECT_TRUE(data.size() % 512 == 0);
+      if (file_data_->size() < pos + data.size()) {
+        file_data_->resize(pos + data.size());
+      }
+      file_data_->replace(pos, data.size(), data.data(), data.size());
+      return IOStatus::OK();
+    }
+    IOStatus PositionedAppendAsync(
+        const Slice& data, uint64_t offset, const IOOptions& /*options*/,
+        std::function<void(const IOStatus&, void*)> cb, void* cb_arg,
+        void** io_handle, IOHandleDeleter* del_fn,
+        IODebugContext* /*dbg*/) override {
+      *io_handle = new PendingWrite{data, offset, cb, cb_arg};
+      *del_fn = [](void* handle) { delete static_cast<PendingWrite*>(handle); };
+      num_submitted_++;
+      num_in_flight_++;
+      max_in_flight_ = std::max(max_in_flight_, num_in_flight_);
+      return IOStatus::OK();
+    }
+    void Complete(PendingWrite* pending) {
+      IOStatus s = PositionedAppend(pending->data, pending->offset,
+                                    IOOptions(), nullptr);
+      num_in_flight_--;
+      pending->cb(s, pending->cb_arg);
+    }
+
+    IOStatus Truncate(uint64_t size, const IOOptions& /*options*/,
+                      IODebugContext* /*dbg*/) override {
+      EXPECT_EQ(num_in_flight_, 0);
+      file_data_->resize(size);
+      return IOStatus::OK();
+    }
+    IOStatus Close(const IOOptions& /*options*/,
+                   IODebugContext* /*dbg*/) override {
+      EXPECT_EQ(num_in_flight_, 0);
+      return IOStatus::OK();
+    }
+    IOStatus Flush(const IOOptions& /*options*/,
+                   IODebugContext* /*dbg*/) override {
+      return IOStatus::OK();
+    }
+    IOStatus Sync(const IOOptions& /*options*/,
+                  IODebugContext* /*dbg*/) override {
+      return IOStatus::OK();
+    }
+    IOStatus Fsync(const IOOptions& /*options*/,
+                   IODebugContext* /*dbg*/) override {
+      return IOStatus::OK();
+    }
+    uint64_t GetFileSize(const IOOptions& /*options*/,
+                         IODebugContext* /*dbg*/) override {
+      return file_data_->size();
+    }
+    bool use_direct_io() const override { return true; }
+
+    std::string* file_data_;
+    int num_submitted_ = 0;
+    int num_in_flight_ = 0;
+    int max_in_flight_ = 0;
+  };
+
+  class FakeFS : public FileSystemWrapper {
+   public:
+    explicit FakeFS(const std::shared_ptr<FileSystem>& _target)
+        : FileSystemWrapper(_target) {}
+    static const char* kClassName() { return "FakeFS"; }
+    const char* Name() const override { return kClassName(); }
+
+    IOStatus Poll(std::vector<void*>& io_handles,
+                  size_t /*min_completions*/) override {
+      for (void* handle : io_handles) {
+        file_->Complete(static_cast<PendingWrite*>(handle));
+      }
+      return IOStatus::OK();
+    }
+
+    FakeWF* file_ = nullptr;
+  };
+
+  Random r(301);
+  FakeFS fs(FileSystem::Default());
+  FileOptions file_options;
+  file_options.writable_file_max_buffer_size = 64 * 1024;
+  file_options.writable_file_num_buffers = 3;
+  std::string actual;
+  std::unique_ptr<FakeWF> wf(new FakeWF(&actual));
+  FakeWF* file = wf.get();
+  fs.file_ = file;
+  std::unique_ptr<WritableFileWriter> writer(new WritableFileWriter(
+      std::move(wf), "" /* don't care */, file_options, nullptr, nullptr,
+      nullptr, Histograms::HISTOGRAM_ENUM_MAX, {}, nullptr, false, false,
+      &fs));
+
+  std::string target;
+  for (int i = 0; i < 100; i++) {
+    uint32_t num = r.Skewed(16) * 100 + r.Uniform(100);
+    std::string random_string = r.RandomString(num);
+    ASSERT_OK(writer->Append(IOOptions(), Slice(random_string.c_str(), num)));
+    target.append(random_string.c_str(), num);
+    if (i == 50) {
+      // Flush() waits for the writes in flight
+      ASSERT_OK(writer->Flush(IOOptions()));
+      ASSERT_EQ(file->num_in_flight_, 0);
+    }
+  }
+  ASSERT_OK(writer->Close(IOOptions()));
+  ASSERT_GT(file->num_submitted_, 0);
+  ASSERT_EQ(file->max_in_flight_, 2);
+  ASSERT_EQ(file->num_in_flight_, 0);
+  ASSERT_EQ(target, actual);
+}
+
 TEST_F(WritableFileWriterTest, AlignedBufferedWrites) {
   class FakeWF : public FSWritableFile {
    public:
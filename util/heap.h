@@ -8,6 +8,8 @@
 #include <algorithm>
 #include <cstdint>
 #include <functional>
+#include <limits>
+#include <vector>
 
 #include "port/port.h"
 #include "util/autovector.h"
@@ -171,4 +173,172 @@ class BinaryHeap {
   size_t root_cmp_cache_ = std::numeric_limits<size_t>::max();
 };
 
+// Tournament tree with the same interface and ordering as BinaryHeap. Each
+// value occupies a leaf until it is popped, and each inner node holds the
+// leaf that wins among its subtree. Changing a leaf replays only the matches
+// on its path to the root, so replace_top() and pop() take at most logN
+// comparisons where BinaryHeap takes up to 2logN, and push() stops as soon
+// as the value loses a match.
+//
+// As in BinaryHeap::replace_top(), the common case of the top staying on top
+// takes a single comparison: once the top has stayed on top through a replay,
+// the best of the other values (the runner-up) is remembered, and a
+// replacement that still beats the runner-up needs no replay at all.
+template <typename T, typename Compare = std::less<T>>
+class TournamentTree {
+ public:
+  TournamentTree() {}
+  explicit TournamentTree(Compare cmp) : cmp_(std::move(cmp)) {}
+
+  void push(const T& value) {
+    if (free_leaves_.empty()) {
+      Grow();
+    }
+    const size_t leaf = free_leaves_.back();
+    free_leaves_.pop_back();
+    leaves_[leaf] = value;
+    occupied_[leaf] = true;
+    ++size_;
+    const size_t prev_top = winners_[1];
+    Replay(leaf);
+    if (runner_up_ != kNone) {
+      if (winners_[1] == leaf) {
+        runner_up_ = prev_top;
+      } else if (Beats(leaf, runner_up_)) {
+        runner_up_ = leaf;
+      }
+    }
+  }
+
+  const T& top() const {
+    assert(!empty());
+    return leaves_[winners_[1]];
+  }
+
+  void replace_top(const T& value) {
+    assert(!empty());
+    const size_t top = winners_[1];
+    leaves_[top] = value;
+    if (runner_up_ != kNone && Beats(top, runner_up_)) {
+      // Still wins every match on its path
+      return;
+    }
+    Replay(top);
+    if (winners_[1] == top) {
+      UpdateRunnerUp();
+    } else {
+      runner_up_ = kNone;
+    }
+  }
+
+  void pop() {
+    assert(!empty());
+    const size_t top = winners_[1];
+    leaves_[top] = T();
+    occupied_[top] = false;
+    free_leaves_.push_back(top);
+    --size_;
+    Replay(top);
+    runner_up_ = kNone;
+  }
+
+  void clear() {
+    free_leaves_.clear();
+    for (size_t leaf = capacity_; leaf > 0; --leaf) {
+      leaves_[leaf - 1] = T();
+      occupied_[leaf - 1] = false;
+      free_leaves_.push_back(leaf - 1);
+    }
+    // Without values, the left subtree wins every match
+    for (size_t node = capacity_; node-- > 1;) {
+      winners_[node] = winners_[2 * node];
+    }
+    size_ = 0;
+    runner_up_ = kNone;
+  }
+
+  bool empty() const { return size_ == 0; }
+
+  size_t size() const { return size_; }
+
+ private:
+  static constexpr size_t kNone = std::numeric_limits<size_t>::max();
+
+  // Whether the value at leaf `a` comes out strictly before the one at leaf
+  // `b`. A leaf without a value never does.
+  bool Beats(size_t a, size_t b) const {
+    if (!occupied_[a]) {
+      return false;
+    }
+    if (!occupied_[b]) {
+      return true;
+    }
+    return cmp_(leaves_[b], leaves_[a]);
+  }
+
+  void Match(size_t node) {
+    const size_t left = winners_[2 * node];
+    const size_t right = winners_[2 * node + 1];
+    winners_[node] = Beats(right, left) ? right : left;
+  }
+
+  // Replays the matches on the path from `leaf` to the root, after its value
+  // changed
+  void Replay(size_t leaf) {
+    for (size_t node = (capacity_ + leaf) / 2; node > 0; node /= 2) {
+      const size_t prev_winner = winners_[node];
+      Match(node);
+      if (winners_[node] == prev_winner && prev_winner != leaf) {
+        // Nothing changes further up
+        break;
+      }
+    }
+  }
+
+  // Requires the top to have won every match on its path
+  void UpdateRunnerUp() {
+    runner_up_ = kNone;
+    for (size_t node = capacity_ + winners_[1]; node > 1; node /= 2) {
+      const size_t other = winners_[node ^ 1];
+      if (occupied_[other] &&
+          (runner_up_ == kNone || Beats(other, runner_up_))) {
+        runner_up_ = other;
+      }
+    }
+  }
+
+  // Doubles the number of leaves and replays all matches
+  void Grow() {
+    const size_t new_capacity = capacity_ == 0 ? 2 : 2 * capacity_;
+    leaves_.resize(new_capacity);
+    occupied_.resize(new_capacity, false);
+    for (size_t leaf = new_capacity; leaf > capacity_; --leaf) {
+      free_leaves_.push_back(leaf - 1);
+    }
+    capacity_ = new_capacity;
+    winners_.resize(2 * capacity_);
+    for (size_t leaf = 0; leaf < capacity_; ++leaf) {
+      winners_[capacity_ + leaf] = leaf;
+    }
+    for (size_t node = capacity_; node-- > 1;) {
+      Match(node);
+    }
+    runner_up_ = kNone;
+  }
+
+  Compare cmp_;
+  // Number of leaves, zero or a power of two
+  size_t capacity_ = 0;
+  size_t size_ = 0;
+  std::vector<T> leaves_;
+  std::vector<bool> occupied_;
+  std::vector<size_t> free_leaves_;
+  // winners_[i] for 0 < i < capacity_ is the winning leaf of the subtree
+  // rooted at inner node i, whose children are 2i and 2i+1. Node capacity_ + j
+  // is leaf j.
+  std::vector<size_t> winners_;
+  // Leaf of the best value other than the top, if known
+  size_t runner_up_ = kNone;
+};
+
 }  // namespace ROCKSDB_NAMESPACE